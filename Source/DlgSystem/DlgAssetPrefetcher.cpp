@@ -0,0 +1,207 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgAssetPrefetcher.h"
+
+#include "Engine/StreamableManager.h"
+
+#include "DlgContext.h"
+#include "DlgSystemSettings.h"
+#include "IDlgSystemModule.h"
+#include "Nodes/DlgNode_Proxy.h"
+#include "Nodes/DlgNode_Selector.h"
+
+void FDlgAssetPrefetcher::Update(const UDlgContext& Context)
+{
+	const UDlgSystemSettings* Settings = GetDefault<UDlgSystemSettings>();
+	const int32 MaxDepth = Settings->bUseSoftReferencesForNodeAssets ? Settings->PrefetchNodeAssetsDepth : 0;
+	if (MaxDepth <= 0)
+	{
+		Reset();
+		return;
+	}
+
+	TMap<int32, int32> NodeDepths;
+	GatherReachableNodes(Context, MaxDepth, NodeDepths);
+
+	// Not reachable anymore
+	for (auto It = NodeHandles.CreateIterator(); It; ++It)
+	{
+		if (!NodeDepths.Contains(It.Key()))
+		{
+			ReleaseNodeHandle(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	// Closer nodes first, they are also loaded with a higher priority
+	NodeDepths.ValueSort(TLess<int32>());
+
+	// The size of the pending loads is not known yet, they are limited by their count instead
+	UpdateLoadedBytes();
+	const int64 BudgetBytes = static_cast<int64>(Settings->PrefetchNodeAssetsBudgetMB) * 1024 * 1024;
+	int64 LoadedBytes = GetLoadedBytes();
+	int32 NumPendingLoads = GetNumPendingLoads();
+
+	FStreamableManager& StreamableManager = IDlgSystemModule::Get().GetStreamableManager();
+	TArray<FSoftObjectPath> AssetPaths;
+	for (const auto& Elem : NodeDepths)
+	{
+		if (LoadedBytes >= BudgetBytes || NumPendingLoads >= Settings->PrefetchNodeAssetsMaxPendingLoads)
+		{
+			break;
+		}
+		if (NodeHandles.Contains(Elem.Key))
+		{
+			continue;
+		}
+
+		const UDlgNode* Node = Context.GetNodeFromIndex(Elem.Key);
+		if (!Node)
+		{
+			continue;
+		}
+
+		AssetPaths.Reset();
+		Node->GetNodeSoftAssets(AssetPaths);
+		if (AssetPaths.Num() == 0)
+		{
+			continue;
+		}
+
+		FNodeHandle& NodeHandle = NodeHandles.Add(Elem.Key);
+		NodeHandle.Handle = StreamableManager.RequestAsyncLoad(
+			AssetPaths,
+			FStreamableDelegate(),
+			FStreamableManager::DefaultAsyncLoadPriority + MaxDepth - Elem.Value
+		);
+
+		// Already loaded assets count right away
+		UpdateLoadedBytes();
+		LoadedBytes = GetLoadedBytes();
+		NumPendingLoads = GetNumPendingLoads();
+	}
+}
+
+void FDlgAssetPrefetcher::Reset()
+{
+	for (auto& Elem : NodeHandles)
+	{
+		ReleaseNodeHandle(Elem.Value);
+	}
+	NodeHandles.Empty();
+}
+
+int64 FDlgAssetPrefetcher::GetLoadedBytes() const
+{
+	int64 LoadedBytes = 0;
+	for (const auto& Elem : NodeHandles)
+	{
+		LoadedBytes += FMath::Max<int64>(Elem.Value.LoadedBytes, 0);
+	}
+	return LoadedBytes;
+}
+
+int32 FDlgAssetPrefetcher::GetNumPendingLoads() const
+{
+	int32 NumPendingLoads = 0;
+	for (const auto& Elem : NodeHandles)
+	{
+		if (Elem.Value.LoadedBytes == INDEX_NONE)
+		{
+			NumPendingLoads++;
+		}
+	}
+	return NumPendingLoads;
+}
+
+void FDlgAssetPrefetcher::GatherReachableNodes(const UDlgContext& Context, int32 MaxDepth, TMap<int32, int32>& OutNodeDepths)
+{
+	// Breadth first, so each node gets its smallest depth first
+	TArray<TPair<int32, int32>> Queue;
+	for (const FDlgEdge& Edge : Context.GetOptionsArray())
+	{
+		Queue.Emplace(Edge.TargetIndex, 1);
+	}
+
+	for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); QueueIndex++)
+	{
+		const int32 NodeIndex = Queue[QueueIndex].Key;
+		const int32 Depth = Queue[QueueIndex].Value;
+		const UDlgNode* Node = Context.GetNodeFromIndex(NodeIndex);
+		if (!Node || OutNodeDepths.Contains(NodeIndex))
+		{
+			continue;
+		}
+		OutNodeDepths.Add(NodeIndex, Depth);
+
+		// The hops are entered in the same step as the node they lead to
+		if (const UDlgNode_Proxy* Proxy = Cast<UDlgNode_Proxy>(Node))
+		{
+			Queue.Emplace(Proxy->GetTargetNodeIndex(), Depth);
+			continue;
+		}
+		const int32 ChildDepth = Node->IsA<UDlgNode_Selector>() ? Depth : Depth + 1;
+		if (ChildDepth > MaxDepth)
+		{
+			continue;
+		}
+
+		// The conditions further ahead depend on the choices of the player, take all the children
+		for (const FDlgEdge& Edge : Node->GetNodeChildren())
+		{
+			Queue.Emplace(Edge.TargetIndex, ChildDepth);
+		}
+	}
+}
+
+void FDlgAssetPrefetcher::UpdateLoadedBytes()
+{
+	TArray<UObject*> LoadedAssets;
+	for (auto& Elem : NodeHandles)
+	{
+		FNodeHandle& NodeHandle = Elem.Value;
+		if (NodeHandle.LoadedBytes != INDEX_NONE)
+		{
+			continue;
+		}
+
+		// Nothing was requested, not pending either
+		if (!NodeHandle.Handle.IsValid())
+		{
+			NodeHandle.LoadedBytes = 0;
+			continue;
+		}
+		if (!NodeHandle.Handle->HasLoadCompleted())
+		{
+			continue;
+		}
+
+		LoadedAssets.Reset();
+		NodeHandle.Handle->GetLoadedAssets(LoadedAssets);
+		NodeHandle.LoadedBytes = 0;
+		for (const UObject* Asset : LoadedAssets)
+		{
+			if (Asset)
+			{
+				NodeHandle.LoadedBytes += Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+			}
+		}
+	}
+}
+
+void FDlgAssetPrefetcher::ReleaseNodeHandle(FNodeHandle& NodeHandle)
+{
+	if (!NodeHandle.Handle.IsValid())
+	{
+		return;
+	}
+
+	if (NodeHandle.Handle->IsLoadingInProgress())
+	{
+		NodeHandle.Handle->CancelHandle();
+	}
+	else
+	{
+		NodeHandle.Handle->ReleaseHandle();
+	}
+	NodeHandle.Handle.Reset();
+}
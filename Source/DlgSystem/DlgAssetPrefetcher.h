@@ -0,0 +1,51 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDlgContext;
+struct FStreamableHandle;
+
+/**
+ * Streams the soft referenced assets of the nodes the context can reach in the next few steps,
+ * so they are already loaded by the time their node is entered.
+ * See UDlgSystemSettings::bUseSoftReferencesForNodeAssets and UDlgSystemSettings::PrefetchNodeAssetsDepth
+ */
+class DLGSYSTEM_API FDlgAssetPrefetcher
+{
+	typedef FDlgAssetPrefetcher Self;
+
+public:
+	// Prefetches the nodes reachable from the options of the Context, the loads of the nodes not reachable anymore are cancelled
+	void Update(const UDlgContext& Context);
+
+	// Cancels and releases everything
+	void Reset();
+
+	// Stats
+	int32 GetNumPrefetchedNodes() const { return NodeHandles.Num(); }
+	int64 GetLoadedBytes() const;
+	int32 GetNumPendingLoads() const;
+
+	// Gathers the nodes reachable from the options of the Context in MaxDepth steps, Key: NodeIndex, Value: Depth
+	// The selectors and proxies are only hops, they do not count as a step.
+	static void GatherReachableNodes(const UDlgContext& Context, int32 MaxDepth, TMap<int32, int32>& OutNodeDepths);
+
+protected:
+	struct FNodeHandle
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+
+		// Size of the loaded assets, INDEX_NONE until the load is completed
+		int64 LoadedBytes = INDEX_NONE;
+	};
+
+	// Updates the LoadedBytes of the completed loads
+	void UpdateLoadedBytes();
+
+	static void ReleaseNodeHandle(FNodeHandle& NodeHandle);
+
+protected:
+	// Key: NodeIndex
+	TMap<int32, FNodeHandle> NodeHandles;
+};
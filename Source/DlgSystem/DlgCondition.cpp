@@ -7,9 +7,11 @@
 #include "Nodes/DlgNode.h"
 #include "NYReflectionHelper.h"
 #include "Kismet/GameplayStatics.h"
-#include "DlgDialogueParticipant.h"
+#include "DlgParticipantCaller.h"
 #include "DlgHelper.h"
 #include "Logging/DlgLogger.h"
+#include "DlgRuntimeStats.h"
+#include "DlgTrace.h"
 
 bool FDlgCondition::EvaluateArray(const UDlgContext& Context, const TArray<FDlgCondition>& ConditionsArray, FName DefaultParticipantName)
 {
@@ -37,6 +39,11 @@ bool FDlgCondition::EvaluateArray(const UDlgContext& Context, const TArray<FDlgC
 
 bool FDlgCondition::IsConditionMet(const UDlgContext& Context, const UObject* Participant) const
 {
+	FDlgScopedRuntimeTimer ScopedTimer(FDlgRuntimeStats::Get().AddConditionEvaluation(*this));
+	SCOPE_CYCLE_COUNTER(STAT_DlgCondition);
+	INC_DWORD_STAT(STAT_DlgNumConditions);
+	DLG_TRACE_SCOPE(TEXT("Condition"), ConditionTypeToString(ConditionType), Context);
+
 	bool bHasParticipant = true;
 	if (IsParticipantInvolved())
 	{
@@ -66,19 +73,19 @@ bool FDlgCondition::IsConditionMet(const UDlgContext& Context, const UObject* Pa
 	switch (ConditionType)
 	{
 		case EDlgConditionType::EventCall:
-			return IDlgDialogueParticipant::Execute_CheckCondition(Participant, &Context, CallbackName) == bBoolValue;
+			return FDlgParticipantCaller::CheckCondition(Participant, &Context, CallbackName) == bBoolValue;
 
 		case EDlgConditionType::BoolCall:
-			return CheckBool(Context, IDlgDialogueParticipant::Execute_GetBoolValue(Participant, CallbackName));
+			return CheckBool(Context, FDlgParticipantCaller::GetBoolValue(Participant, CallbackName));
 
 		case EDlgConditionType::FloatCall:
-			return CheckFloat(Context, static_cast<double>(IDlgDialogueParticipant::Execute_GetFloatValue(Participant, CallbackName)));
+			return CheckFloat(Context, static_cast<double>(FDlgParticipantCaller::GetFloatValue(Participant, CallbackName)));
 
 		case EDlgConditionType::IntCall:
-			return CheckInt(Context, IDlgDialogueParticipant::Execute_GetIntValue(Participant, CallbackName));
+			return CheckInt(Context, FDlgParticipantCaller::GetIntValue(Participant, CallbackName));
 
 		case EDlgConditionType::NameCall:
-			return CheckName(Context, IDlgDialogueParticipant::Execute_GetNameValue(Participant, CallbackName));
+			return CheckName(Context, FDlgParticipantCaller::GetNameValue(Participant, CallbackName));
 
 
 		case EDlgConditionType::ClassBoolVariable:
@@ -100,8 +107,13 @@ bool FDlgCondition::IsConditionMet(const UDlgContext& Context, const UObject* Pa
 		case EDlgConditionType::HasSatisfiedChild:
 			{
 				// Use the GUID if it is valid as it is more reliable
-				const UDlgNode* Node = GUID.IsValid() ? Context.GetNodeFromGUID(GUID) : Context.GetNodeFromIndex(IntValue);
-				return Node != nullptr ? Node->HasAnySatisfiedChild(Context, {}) == bBoolValue : false;
+				const int32 NodeIndex = GUID.IsValid() ? Context.GetNodeIndexForGUID(GUID) : IntValue;
+				if (Context.GetNodeFromIndex(NodeIndex) == nullptr)
+				{
+					return false;
+				}
+
+				return Context.HasNodeAnySatisfiedChild(NodeIndex) == bBoolValue;
 			}
 
 		default:
@@ -123,7 +135,7 @@ bool FDlgCondition::CheckFloat(const UDlgContext& Context, double Value) const
 
 		if (CompareType == EDlgCompare::ToVariable)
 		{
-			ValueToCheckAgainst = static_cast<double>(IDlgDialogueParticipant::Execute_GetFloatValue(OtherParticipant, OtherVariableName));
+			ValueToCheckAgainst = static_cast<double>(FDlgParticipantCaller::GetFloatValue(OtherParticipant, OtherVariableName));
 		}
 		else
 		{
@@ -173,7 +185,7 @@ bool FDlgCondition::CheckInt(const UDlgContext& Context, int32 Value) const
 
 		if (CompareType == EDlgCompare::ToVariable)
 		{
-			ValueToCheckAgainst = IDlgDialogueParticipant::Execute_GetIntValue(OtherParticipant, OtherVariableName);
+			ValueToCheckAgainst = FDlgParticipantCaller::GetIntValue(OtherParticipant, OtherVariableName);
 		}
 		else
 		{
@@ -224,7 +236,7 @@ bool FDlgCondition::CheckBool(const UDlgContext& Context, bool bValue) const
 		bool bValueToCheckAgainst;
 		if (CompareType == EDlgCompare::ToVariable)
 		{
-			bValueToCheckAgainst = IDlgDialogueParticipant::Execute_GetBoolValue(OtherParticipant, OtherVariableName);
+			bValueToCheckAgainst = FDlgParticipantCaller::GetBoolValue(OtherParticipant, OtherVariableName);
 		}
 		else
 		{
@@ -251,7 +263,7 @@ bool FDlgCondition::CheckName(const UDlgContext& Context, FName Value) const
 
 		if (CompareType == EDlgCompare::ToVariable)
 		{
-			ValueToCheckAgainst = IDlgDialogueParticipant::Execute_GetNameValue(OtherParticipant, OtherVariableName);
+			ValueToCheckAgainst = FDlgParticipantCaller::GetNameValue(OtherParticipant, OtherVariableName);
 		}
 		else
 		{
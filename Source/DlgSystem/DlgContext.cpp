@@ -4,6 +4,7 @@
 #include "Net/UnrealNetwork.h"
 #include "Engine/Texture2D.h"
 #include "Engine/Blueprint.h"
+#include "Engine/StreamableManager.h"
 
 #include "DlgConstants.h"
 #include "Nodes/DlgNode.h"
@@ -11,7 +12,12 @@
 #include "Nodes/DlgNode_SpeechSequence.h"
 #include "DlgDialogueParticipant.h"
 #include "DlgMemory.h"
+#include "DlgMemorySubsystem.h"
+#include "DlgSystemSettings.h"
 #include "Logging/DlgLogger.h"
+#include "DlgRuntimeStats.h"
+#include "DlgTrace.h"
+#include "IDlgSystemModule.h"
 
 
 UDlgContext::UDlgContext(const FObjectInitializer& ObjectInitializer)
@@ -20,11 +26,20 @@ UDlgContext::UDlgContext(const FObjectInitializer& ObjectInitializer)
 	//UObject.bReplicates = true;
 }
 
+void UDlgContext::BeginDestroy()
+{
+	FDlgRuntimeStats::Get().RemoveContext(this);
+	ReleaseActiveNodeAssets();
+	Super::BeginDestroy();
+}
+
 void UDlgContext::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	DOREPLIFETIME(ThisClass, Dialogue);
 	DOREPLIFETIME(ThisClass, SerializedParticipants);
+	DOREPLIFETIME(ThisClass, RandomSeed);
+	DOREPLIFETIME(ThisClass, RandomStreamState);
 }
 
 void UDlgContext::SerializeParticipants()
@@ -59,7 +74,7 @@ bool UDlgContext::ChooseOption(int32 OptionIndex)
 		}
 	}
 
-	bDialogueEnded = true;
+	EndDialogue();
 	return false;
 }
 
@@ -74,7 +89,7 @@ bool UDlgContext::ChooseSpeechSequenceOptionFromReplicated(int32 OptionIndex)
 		}
 	}
 
-	bDialogueEnded = true;
+	EndDialogue();
 	return false;
 }
 
@@ -83,7 +98,7 @@ bool UDlgContext::ChooseOptionFromAll(int32 Index)
 	if (!AllChildren.IsValidIndex(Index))
 	{
 		LogErrorWithContext(FString::Printf(TEXT("ChooseOptionFromAll - INVALID given Index = %d"), Index));
-		bDialogueEnded = true;
+		EndDialogue();
 		return false;
 	}
 
@@ -95,7 +110,7 @@ bool UDlgContext::ChooseOptionFromAll(int32 Index)
 		}
 	}
 
-	bDialogueEnded = true;
+	EndDialogue();
 	return false;
 }
 
@@ -109,7 +124,11 @@ bool UDlgContext::ReevaluateOptions()
 		return false;
 	}
 
-	return Node->ReevaluateChildren(*this, {});
+	const bool bResult = ReevaluateNodeChildren(*Node);
+
+	// The options might have changed
+	AssetPrefetcher.Update(*this);
+	return bResult;
 }
 
 const FText& UDlgContext::GetOptionText(int32 OptionIndex) const
@@ -281,6 +300,99 @@ UObject* UDlgContext::GetActiveNodeGenericData() const
 	return Node->GetNodeGenericData();
 }
 
+void UDlgContext::GetActiveNodeVoiceSoundBaseAsync(const FDlgOnActiveNodeAssetLoaded& OnLoaded) const
+{
+	const UDlgNode* Node = GetActiveNode();
+	if (!IsValid(Node))
+	{
+		LogErrorWithContext(TEXT("GetActiveNodeVoiceSoundBaseAsync - INVALID Active Node"));
+		OnLoaded.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	LoadAssetAsync(Node->GetNodeSoftVoiceSoundBase().ToSoftObjectPath(), OnLoaded);
+}
+
+void UDlgContext::GetActiveNodeVoiceDialogueWaveAsync(const FDlgOnActiveNodeAssetLoaded& OnLoaded) const
+{
+	const UDlgNode* Node = GetActiveNode();
+	if (!IsValid(Node))
+	{
+		LogErrorWithContext(TEXT("GetActiveNodeVoiceDialogueWaveAsync - INVALID Active Node"));
+		OnLoaded.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	LoadAssetAsync(Node->GetNodeSoftVoiceDialogueWave().ToSoftObjectPath(), OnLoaded);
+}
+
+void UDlgContext::GetActiveNodeGenericDataAsync(const FDlgOnActiveNodeAssetLoaded& OnLoaded) const
+{
+	const UDlgNode* Node = GetActiveNode();
+	if (!IsValid(Node))
+	{
+		LogErrorWithContext(TEXT("GetActiveNodeGenericDataAsync - INVALID Active Node"));
+		OnLoaded.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	LoadAssetAsync(Node->GetNodeSoftGenericData().ToSoftObjectPath(), OnLoaded);
+}
+
+void UDlgContext::LoadAssetAsync(const FSoftObjectPath& AssetPath, const FDlgOnActiveNodeAssetLoaded& OnLoaded)
+{
+	if (AssetPath.IsNull())
+	{
+		OnLoaded.ExecuteIfBound(nullptr);
+		return;
+	}
+	if (UObject* Asset = AssetPath.ResolveObject())
+	{
+		OnLoaded.ExecuteIfBound(Asset);
+		return;
+	}
+
+	IDlgSystemModule::Get().GetStreamableManager().RequestAsyncLoad(
+		AssetPath,
+		FStreamableDelegate::CreateLambda([AssetPath, OnLoaded]()
+		{
+			OnLoaded.ExecuteIfBound(AssetPath.ResolveObject());
+		})
+	);
+}
+
+void UDlgContext::LoadActiveNodeAssets()
+{
+	TArray<FSoftObjectPath> AssetPaths;
+	if (const UDlgNode* Node = GetActiveNode())
+	{
+		Node->GetNodeSoftAssets(AssetPaths);
+	}
+
+	// Request the new assets before releasing the old ones, the assets shared by the two nodes stay loaded
+	TSharedPtr<FStreamableHandle> PreviousHandle = MoveTemp(ActiveNodeAssetsHandle);
+	if (AssetPaths.Num() > 0)
+	{
+		ActiveNodeAssetsHandle = IDlgSystemModule::Get().GetStreamableManager().RequestAsyncLoad(AssetPaths);
+	}
+	if (PreviousHandle.IsValid())
+	{
+		PreviousHandle->ReleaseHandle();
+	}
+
+	AssetPrefetcher.Update(*this);
+}
+
+void UDlgContext::ReleaseActiveNodeAssets()
+{
+	if (ActiveNodeAssetsHandle.IsValid())
+	{
+		ActiveNodeAssetsHandle->ReleaseHandle();
+		ActiveNodeAssetsHandle.Reset();
+	}
+	AssetPrefetcher.Reset();
+}
+
 UDlgNodeData* UDlgContext::GetActiveNodeData() const
 {
 	const UDlgNode* Node = GetActiveNode();
@@ -376,6 +488,9 @@ FText UDlgContext::GetActiveNodeParticipantDisplayName() const
 
 UObject* UDlgContext::GetMutableParticipant(FName ParticipantName) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_DlgParticipantLookup);
+	DLG_TRACE_SCOPE_STATIC(DlgParticipantLookup);
+
 	auto* ParticipantPtr = Participants.Find(ParticipantName);
 	if (ParticipantPtr != nullptr && IsValid(*ParticipantPtr))
 	{
@@ -387,6 +502,9 @@ UObject* UDlgContext::GetMutableParticipant(FName ParticipantName) const
 
 const UObject* UDlgContext::GetParticipant(FName ParticipantName) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_DlgParticipantLookup);
+	DLG_TRACE_SCOPE_STATIC(DlgParticipantLookup);
+
 	auto* ParticipantPtr = Participants.Find(ParticipantName);
 	if (ParticipantPtr != nullptr && IsValid(*ParticipantPtr))
 	{
@@ -398,6 +516,9 @@ const UObject* UDlgContext::GetParticipant(FName ParticipantName) const
 
 UObject* UDlgContext::GetParticipantFromName(const FDlgParticipantName& Participant)
 {
+	SCOPE_CYCLE_COUNTER(STAT_DlgParticipantLookup);
+	DLG_TRACE_SCOPE_STATIC(DlgParticipantLookup);
+
 	if (UObject** ParticipantObjectPtr = Participants.Find(Participant.ParticipantName))
 	{
 		return *ParticipantObjectPtr;
@@ -498,7 +619,7 @@ bool UDlgContext::IsOptionConnectedToEndNode(int32 Index, bool bIndexSkipsUnsati
 	return false;
 }
 
-bool UDlgContext::EnterNode(int32 NodeIndex, TSet<const UDlgNode*> NodesEnteredWithThisStep)
+bool UDlgContext::EnterNode(int32 NodeIndex)
 {
 	check(Dialogue);
 	UDlgNode* Node = GetMutableNodeFromIndex(NodeIndex);
@@ -508,10 +629,48 @@ bool UDlgContext::EnterNode(int32 NodeIndex, TSet<const UDlgNode*> NodesEnteredW
 		return false;
 	}
 
+	// Only the outermost call starts a new step, selectors and proxies enter their targets in the same step
+	const bool bOutermost = EnteredNodesStamps.Depth == 0;
+	if (bOutermost)
+	{
+		EnteredNodesStamps.BeginStep();
+	}
+	if (EnteredNodesStamps.IsVisited(NodeIndex))
+	{
+		LogErrorWithContext(FString::Printf(
+			TEXT("EnterNode - Failed to enter %s node at NodeIndex = %d, it was entered multiple times in a single step. "
+				"Theoretically with some condition magic it could make sense, but chances are that it is an endless loop, "
+				"thus entering the same node twice with a single step is not supported. Dialogue is terminated."),
+			*Node->GetClass()->GetName(), NodeIndex
+		));
+		return false;
+	}
+	EnteredNodesStamps.Visit(NodeIndex);
+
 	ActiveNodeIndex = NodeIndex;
 	SetNodeVisited(NodeIndex, Node->GetGUID());
 
-	return Node->HandleNodeEnter(*this, NodesEnteredWithThisStep);
+	SCOPE_CYCLE_COUNTER(STAT_DlgNodeEnter);
+	INC_DWORD_STAT(STAT_DlgNumNodesEntered);
+	DLG_TRACE_SCOPE(TEXT("NodeEnter"), *this);
+
+	EnteredNodesStamps.Depth++;
+	const bool bResult = Node->HandleNodeEnter(*this);
+	EnteredNodesStamps.Depth--;
+
+	// The node we ended up in is known only after the outermost enter
+	if (bOutermost && !bEvaluatingBark)
+	{
+		if (bResult)
+		{
+			LoadActiveNodeAssets();
+		}
+		else
+		{
+			ReleaseActiveNodeAssets();
+		}
+	}
+	return bResult;
 }
 
 UDlgContext* UDlgContext::CreateCopy() const
@@ -538,13 +697,28 @@ UDlgContext* UDlgContext::CreateCopy() const
 	Context->AllChildren = AllChildren;
 	Context->History = History;
 	Context->bDialogueEnded = bDialogueEnded;
+	Context->MemorySubsystem = MemorySubsystem;
+	Context->bMemoryBound = bMemoryBound;
+	Context->RandomSeed = RandomSeed;
+	Context->RandomStreamState = RandomStreamState;
+	Context->RandomStream = RandomStream;
 
 	return Context;
 }
 
 void UDlgContext::SetNodeVisited(int32 NodeIndex, const FGuid& NodeGUID)
 {
-	FDlgMemory::Get().SetNodeVisited(Dialogue->GetGUID(), NodeIndex, NodeGUID);
+	// The barks have no history of their own
+	if (bEvaluatingBark)
+	{
+		if (bBarkRecordHistory)
+		{
+			GetMemory().SetNodeVisited(Dialogue->GetGUID(), NodeIndex, NodeGUID);
+		}
+		return;
+	}
+
+	GetMemory().SetNodeVisited(Dialogue->GetGUID(), NodeIndex, NodeGUID);
 	History.Add(NodeIndex, NodeGUID);
 }
 
@@ -555,12 +729,37 @@ bool UDlgContext::IsNodeVisited(int32 NodeIndex, const FGuid& NodeGUID, bool bLo
 		return History.Contains(NodeIndex, NodeGUID);
 	}
 
-	return FDlgMemory::Get().IsNodeVisited(Dialogue->GetGUID(), NodeIndex, NodeGUID);
+	return GetMemory().IsNodeVisited(Dialogue->GetGUID(), NodeIndex, NodeGUID);
+}
+
+void UDlgContext::ModifyNodeSavedData(const FGuid& NodeGUID, TFunctionRef<void(FDlgNodeSavedData&)> Func)
+{
+	GetMemory().ModifyNodeData(Dialogue->GetGUID(), NodeGUID, Func);
 }
 
 FDlgNodeSavedData& UDlgContext::GetNodeSavedData(const FGuid& NodeGUID)
 {
-	return FDlgMemory::Get().FindOrAddEntry(Dialogue->GetGUID()).GetNodeData(NodeGUID);
+	return GetMemory().FindOrAddEntryUnsafe(Dialogue->GetGUID()).GetNodeData(NodeGUID);
+}
+
+FDlgMemory& UDlgContext::GetMemory() const
+{
+	if (!bMemoryBound)
+	{
+		return FDlgMemory::Get(this);
+	}
+	if (UDlgMemorySubsystem* Subsystem = MemorySubsystem.Get())
+	{
+		return Subsystem->GetMemory();
+	}
+
+	return FDlgMemory::Get();
+}
+
+void UDlgContext::BindMemory(const UObject* WorldContextObject)
+{
+	MemorySubsystem = GetDefault<UDlgSystemSettings>()->bDialogueHistoryPerGameInstance ? UDlgMemorySubsystem::Get(WorldContextObject) : nullptr;
+	bMemoryBound = true;
 }
 
 UDlgNode_SpeechSequence* UDlgContext::GetMutableActiveNodeAsSpeechSequence() const
@@ -617,15 +816,68 @@ const UDlgNode* UDlgContext::GetNodeFromGUID(const FGuid& NodeGUID) const
 	return Dialogue->GetMutableNodeFromGUID(NodeGUID);
 }
 
-bool UDlgContext::IsNodeEnterable(int32 NodeIndex, TSet<const UDlgNode*> AlreadyVisitedNodes) const
+bool UDlgContext::IsNodeEnterable(int32 NodeIndex) const
 {
 	check(Dialogue);
-	if (const UDlgNode* Node = GetNodeFromIndex(NodeIndex))
+	const UDlgNode* Node = GetNodeFromIndex(NodeIndex);
+	if (!Node)
 	{
-		return Node->CheckNodeEnterConditions(*this, AlreadyVisitedNodes);
+		return false;
 	}
 
-	return false;
+	// Not part of any evaluation, start a new one
+	if (!EvaluationPathStamps.IsInStep())
+	{
+		const FDlgEvaluationPathScope PathScope(*this);
+		return IsNodeEnterable(NodeIndex);
+	}
+
+	// Already on the evaluation path, stop the endless loop
+	if (EvaluationPathStamps.IsVisited(NodeIndex))
+	{
+		return true;
+	}
+
+	const uint32 PreviousStamp = EvaluationPathStamps.Visit(NodeIndex);
+	const bool bEnterable = Node->CheckNodeEnterConditions(*this);
+	EvaluationPathStamps.Unvisit(NodeIndex, PreviousStamp);
+	return bEnterable;
+}
+
+bool UDlgContext::HasNodeAnySatisfiedChild(int32 NodeIndex) const
+{
+	check(Dialogue);
+	const UDlgNode* Node = GetNodeFromIndex(NodeIndex);
+	if (!Node)
+	{
+		return false;
+	}
+
+	// Already evaluated in this pass
+	if (SatisfiedChildStamps.IsVisited(NodeIndex))
+	{
+		return SatisfiedChildResults[NodeIndex];
+	}
+
+	bool bResult = false;
+	{
+		// Not part of the evaluation the caller might be in
+		const FDlgEvaluationPathScope PathScope(*this);
+		bResult = Node->HasAnySatisfiedChild(*this);
+	}
+
+	// Only cache while in a pass, outside of it the values might change between the calls
+	if (SatisfiedChildStamps.IsInStep())
+	{
+		SatisfiedChildStamps.Visit(NodeIndex);
+		if (NodeIndex >= SatisfiedChildResults.Num())
+		{
+			SatisfiedChildResults.Add(false, NodeIndex + 1 - SatisfiedChildResults.Num());
+		}
+		SatisfiedChildResults[NodeIndex] = bResult;
+	}
+
+	return bResult;
 }
 
 bool UDlgContext::CanBeStarted(UDlgDialogue* InDialogue, const TMap<FName, UObject*>& InParticipants)
@@ -657,11 +909,11 @@ bool UDlgContext::CanBeStarted(UDlgDialogue* InDialogue, const TMap<FName, UObje
 	{
 		for (const FDlgEdge& ChildLink : StartNode->GetNodeChildren())
 		{
-			if (ChildLink.Evaluate(*Context, {}))
+			if (ChildLink.Evaluate(*Context))
 			{
 				// Simulate EnterNode
 				UDlgNode* Node = Context->GetMutableNodeFromIndex(ChildLink.TargetIndex);
-				if (Node && Node->HasAnySatisfiedChild(*Context, {}))
+				if (Node && Node->HasAnySatisfiedChild(*Context))
 				{
 					return true;
 				}
@@ -684,6 +936,8 @@ bool UDlgContext::StartWithContext(const FString& ContextString, UDlgDialogue* I
 	{
 		return false;
 	}
+	FDlgRuntimeStats::Get().AddContext(this);
+	BindMemory(this);
 
 	// Evaluate edges/children of the start node
 
@@ -691,9 +945,9 @@ bool UDlgContext::StartWithContext(const FString& ContextString, UDlgDialogue* I
 	{
 		for (const FDlgEdge& ChildLink : StartNode->GetNodeChildren())
 		{
-			if (ChildLink.Evaluate(*this, {}))
+			if (ChildLink.Evaluate(*this))
 			{
-				if (EnterNode(ChildLink.TargetIndex, {}))
+				if (EnterNode(ChildLink.TargetIndex))
 				{
 					return true;
 				}
@@ -708,6 +962,59 @@ bool UDlgContext::StartWithContext(const FString& ContextString, UDlgDialogue* I
 	return false;
 }
 
+bool UDlgContext::EvaluateBark(UDlgDialogue* InDialogue, UObject* Participant, bool bRecordHistory, FDlgBarkResult& OutResult)
+{
+	OutResult = FDlgBarkResult{};
+	if (!ValidateParticipantForDialogue(TEXT("EvaluateBark"), InDialogue, Participant))
+	{
+		return false;
+	}
+
+	// Not replicated and not serialized, so the participants are set directly
+	Dialogue = InDialogue;
+	Participants.Reset();
+	Participants.Add(IDlgDialogueParticipant::Execute_GetParticipantName(Participant), Participant);
+	ActiveNodeIndex = INDEX_NONE;
+	bDialogueEnded = false;
+	bEvaluatingBark = true;
+	bBarkRecordHistory = bRecordHistory;
+	BindMemory(Participant);
+
+	auto EnterFirstSatisfiedChild = [this]() -> bool
+	{
+		for (const UDlgNode* StartNode : Dialogue->GetStartNodes())
+		{
+			for (const FDlgEdge& ChildLink : StartNode->GetNodeChildren())
+			{
+				if (ChildLink.Evaluate(*this) && EnterNode(ChildLink.TargetIndex))
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	};
+
+	const UDlgNode* Node = EnterFirstSatisfiedChild() ? GetActiveNode() : nullptr;
+	if (Node)
+	{
+		OutResult.bValid = true;
+		OutResult.NodeIndex = ActiveNodeIndex;
+		OutResult.ParticipantName = Node->GetNodeParticipantName();
+		OutResult.Text = Node->GetNodeText();
+		OutResult.SpeakerState = Node->GetSpeakerState();
+		OutResult.VoiceSoundBase = Node->GetNodeSoftVoiceSoundBase();
+		OutResult.VoiceDialogueWave = Node->GetNodeSoftVoiceDialogueWave();
+	}
+
+	// Do not keep anything alive
+	Dialogue = nullptr;
+	Participants.Reset();
+	ActiveNodeIndex = INDEX_NONE;
+	bEvaluatingBark = false;
+	return OutResult.bValid;
+}
+
 bool UDlgContext::StartWithContextFromNode(
 	const FString& ContextString,
 	UDlgDialogue* InDialogue,
@@ -729,6 +1036,8 @@ bool UDlgContext::StartWithContextFromNode(
 	{
 		return false;
 	}
+	FDlgRuntimeStats::Get().AddContext(this);
+	BindMemory(this);
 
 	// Get the StartNodeIndex from the GUID
 	if (StartNodeGUID.IsValid())
@@ -748,13 +1057,27 @@ bool UDlgContext::StartWithContextFromNode(
 
 	if (bFireEnterEvents)
 	{
-		return EnterNode(StartNodeIndex, {});
+		return EnterNode(StartNodeIndex);
 	}
 
 	ActiveNodeIndex = StartNodeIndex;
 	SetNodeVisited(StartNodeIndex, Node->GetGUID());
+	LoadActiveNodeAssets();
+
+	return ReevaluateNodeChildren(*Node);
+}
 
-	return Node->ReevaluateChildren(*this, {});
+bool UDlgContext::ReevaluateNodeChildren(UDlgNode& Node)
+{
+	FDlgScopedRuntimeTimer ScopedTimer(FDlgRuntimeStats::Get().GetReevaluateOptionsStats());
+	SCOPE_CYCLE_COUNTER(STAT_DlgReevaluateOptions);
+	DLG_TRACE_SCOPE(TEXT("ReevaluateOptions"), *this);
+
+	// New pass, forget the cached HasSatisfiedChild results
+	const uint32 PreviousStep = SatisfiedChildStamps.BeginStep();
+	const bool bResult = Node.ReevaluateChildren(*this);
+	SatisfiedChildStamps.EndStep(PreviousStep);
+	return bResult;
 }
 
 FString UDlgContext::GetContextString() const
@@ -1042,3 +1365,22 @@ bool UDlgContext::ConvertArrayOfParticipantsToMap(
 
 	return true;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgEvaluationPathScope
+FDlgEvaluationPathScope::FDlgEvaluationPathScope(const UDlgContext& Context, const UDlgNode* SourceNode)
+	: Stamps(Context.EvaluationPathStamps)
+{
+	PreviousStep = Stamps.BeginStep();
+	if (SourceNode)
+	{
+		SourceNodeIndex = Context.GetNodeIndexForGUID(SourceNode->GetGUID());
+		SourcePreviousStamp = Stamps.Visit(SourceNodeIndex);
+	}
+}
+
+FDlgEvaluationPathScope::~FDlgEvaluationPathScope()
+{
+	Stamps.Unvisit(SourceNodeIndex, SourcePreviousStamp);
+	Stamps.EndStep(PreviousStep);
+}
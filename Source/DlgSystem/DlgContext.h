@@ -1,11 +1,14 @@
 // Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
 #pragma once
 
+#include "Math/RandomStream.h"
 #include "DlgObject.h"
 #include "DlgDialogue.h"
 #include "Nodes/DlgNode.h"
 #include "DlgMemory.h"
 #include "DlgParticipantName.h"
+#include "DlgAssetPrefetcher.h"
+#include "DlgEventCommandBuffer.h"
 
 #include "DlgContext.generated.h"
 
@@ -16,6 +19,13 @@ class UTexture2D;
 class UDlgNodeData;
 class UDlgNode;
 class UDlgNode_SpeechSequence;
+struct FStreamableHandle;
+
+// Called when the requested asset of the active node is loaded, Asset is null if the node has no such asset
+DECLARE_DYNAMIC_DELEGATE_OneParam(FDlgOnActiveNodeAssetLoaded, UObject*, Asset);
+
+// Called once for each participant after the deferred enter events of a node modified its values, see UDlgSystemSettings::bDeferNodeEnterEvents
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FDlgOnParticipantValuesChanged, UDlgContext*, Context, UObject*, Participant);
 
 // Used to store temporary state of edges
 // This represents a const version of an Edge
@@ -47,6 +57,99 @@ protected:
 	FDlgEdge Edge;
 };
 
+// The node a bark ended up in, see UDlgContext::EvaluateBark
+USTRUCT(BlueprintType)
+struct DLGSYSTEM_API FDlgBarkResult
+{
+	GENERATED_USTRUCT_BODY()
+public:
+	// False if no node could be entered, the rest of the values are the defaults then
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue|Bark")
+	bool bValid = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue|Bark")
+	int32 NodeIndex = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue|Bark")
+	FName ParticipantName = NAME_None;
+
+	// The text formatted with the text arguments
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue|Bark")
+	FText Text;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue|Bark")
+	FName SpeakerState = NAME_None;
+
+	// Not loaded, the bark does not stream the assets of the node
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue|Bark")
+	TSoftObjectPtr<USoundBase> VoiceSoundBase;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue|Bark")
+	TSoftObjectPtr<UDialogueWave> VoiceDialogueWave;
+};
+
+// Loop guard of the recursive node traversals (entering nodes, reevaluating virtual parents, checking enter conditions).
+// Instead of copying a set of the visited nodes down the recursion, each node index is stamped with the step it was visited in.
+struct DLGSYSTEM_API FDlgNodeStepStamps
+{
+public:
+	// Starts a new step, the returned previous step must be restored with EndStep
+	uint32 BeginStep()
+	{
+		const uint32 PreviousStep = Step;
+		LastStep++;
+		if (LastStep == 0)
+		{
+			// Wrapped around, forget all the old stamps
+			Stamps.Init(0, Stamps.Num());
+			LastStep = 1;
+		}
+		Step = LastStep;
+		return PreviousStep;
+	}
+	void EndStep(uint32 PreviousStep) { Step = PreviousStep; }
+	bool IsInStep() const { return Step != 0; }
+
+	bool IsVisited(int32 NodeIndex) const { return Step != 0 && Stamps.IsValidIndex(NodeIndex) && Stamps[NodeIndex] == Step; }
+
+	// Stamps the node with the current step, returns the previous stamp of the node
+	uint32 Visit(int32 NodeIndex)
+	{
+		if (NodeIndex < 0)
+		{
+			return 0;
+		}
+		if (NodeIndex >= Stamps.Num())
+		{
+			Stamps.SetNumZeroed(NodeIndex + 1);
+		}
+
+		const uint32 PreviousStamp = Stamps[NodeIndex];
+		Stamps[NodeIndex] = Step;
+		return PreviousStamp;
+	}
+
+	// Restores the stamp returned by Visit
+	void Unvisit(int32 NodeIndex, uint32 PreviousStamp)
+	{
+		if (Stamps.IsValidIndex(NodeIndex))
+		{
+			Stamps[NodeIndex] = PreviousStamp;
+		}
+	}
+
+public:
+	// Number of nested traversals, the outermost one starts the step
+	int32 Depth = 0;
+
+protected:
+	uint32 Step = 0;
+	uint32 LastStep = 0;
+
+	// Index: Node index
+	// Value: The step the node was last visited in
+	TArray<uint32> Stamps;
+};
 
 UENUM()
 enum class EDlgValidateStatus : uint8
@@ -87,6 +190,7 @@ public:
 	//
 
 	void PostInitProperties() override { Super::PostInitProperties(); }
+	void BeginDestroy() override;
 
 	UDlgContext(const FObjectInitializer& ObjectInitializer);
 
@@ -100,6 +204,10 @@ public:
 
 	UFUNCTION()
 	void OnRep_SerializedParticipants();
+
+	UFUNCTION()
+	void OnRep_RandomStreamState() { RandomStream.Initialize(RandomStreamState); }
+
 	void SerializeParticipants();
 
 	UE_DEPRECATED(4.22, "ChooseChild has been deprecated in Favour of ChooseOption")
@@ -271,6 +379,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Dialogue|ActiveNode")
 	UObject* GetActiveNodeGenericData() const;
 
+	// Async variants of the getters above, for the soft referenced assets that are not loaded yet
+	// See UDlgSystemSettings::bUseSoftReferencesForNodeAssets
+	// OnLoaded is called right away if the asset is already loaded
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|ActiveNode")
+	void GetActiveNodeVoiceSoundBaseAsync(const FDlgOnActiveNodeAssetLoaded& OnLoaded) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|ActiveNode")
+	void GetActiveNodeVoiceDialogueWaveAsync(const FDlgOnActiveNodeAssetLoaded& OnLoaded) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|ActiveNode")
+	void GetActiveNodeGenericDataAsync(const FDlgOnActiveNodeAssetLoaded& OnLoaded) const;
+
 	UFUNCTION(BlueprintPure, Category = "Dialogue|ActiveNode")
 	UDlgNodeData* GetActiveNodeData() const;
 
@@ -364,8 +484,9 @@ public:
 	// the Dialogue jumps to the defined node, or the function returns with false if the conversation is over
 	// Depending on the node the EnterNode() call can lead to other EnterNode() calls - having NodeIndex as active node after the call
 	// is not granted
+	// The nested EnterNode() calls belong to the same step as the outermost one, entering a node twice in a single step fails
 	// Conditions are not checked here - they are expected to be satisfied
-	bool EnterNode(int32 NodeIndex, TSet<const UDlgNode*> NodesEnteredWithThisStep);
+	bool EnterNode(int32 NodeIndex);
 
 	// Adds the node as visited in the current dialogue memory
 	virtual void SetNodeVisited(int32 NodeIndex, const FGuid& NodeGUID);
@@ -373,8 +494,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Dialogue|Context|History")
 	virtual bool IsNodeVisited(int32 NodeIndex, const FGuid& NodeGUID, bool bLocalHistory) const;
 
+	// Calls Func with the saved data of the node under the lock of the dialogue memory, see FDlgMemory::ModifyNodeData
+	virtual void ModifyNodeSavedData(const FGuid& NodeGUID, TFunctionRef<void(FDlgNodeSavedData&)> Func);
+
+	// NOTE: not locked, the returned reference is only valid while no other thread writes to the dialogue memory, use ModifyNodeSavedData
 	virtual FDlgNodeSavedData& GetNodeSavedData(const FGuid& NodeGUID);
 
+	// The dialogue memory of this context, per game instance if bDialogueHistoryPerGameInstance is enabled
+	// Bound when the context is started, so the conditions do not look up the game instance on each evaluation
+	FDlgMemory& GetMemory() const;
+
 	// Gets the Node at the NodeIndex index
 	UFUNCTION(BlueprintPure, Category = "Dialogue|Data", DisplayName = "Get Node From Index")
 	UDlgNode* GetMutableNodeFromIndex(int32 NodeIndex) const;
@@ -404,7 +533,64 @@ public:
 
 	// Checks the enter conditions of the node.
 	// return false if they are not satisfied or if the index is invalid
-	bool IsNodeEnterable(int32 NodeIndex, TSet<const UDlgNode*> AlreadyVisitedNodes) const;
+	// The nodes already on the current evaluation path are considered enterable, see FDlgEvaluationPathScope
+	bool IsNodeEnterable(int32 NodeIndex) const;
+
+	// Does the node at NodeIndex have any satisfied child? Evaluated on a new evaluation path (used by the HasSatisfiedChild condition).
+	// The result is cached for the rest of the ReevaluateOptions pass, so the conditions sharing the node do not evaluate it again.
+	bool HasNodeAnySatisfiedChild(int32 NodeIndex) const;
+
+	// Reevaluates the children of the Node, the HasSatisfiedChild results are cached for the duration of the call
+	// The nodes should reevaluate their children through this, it also records the ReevaluateOptions stats.
+	bool ReevaluateNodeChildren(UDlgNode& Node);
+
+	// Loop guard of the virtual parents reevaluating their children
+	FDlgNodeStepStamps& GetVirtualParentStamps() { return VirtualParentStamps; }
+
+	const FDlgAssetPrefetcher& GetAssetPrefetcher() const { return AssetPrefetcher; }
+
+	// Reused by the nodes to defer their enter events, see UDlgSystemSettings::bDeferNodeEnterEvents
+	FDlgEventCommandBuffer& GetEventCommandBuffer() { return EventCommandBuffer; }
+
+	// Used by the random selector nodes instead of FMath::Rand, so a seeded context picks the same options each time
+	// The current state of the stream is replicated after each pick, so the clients continue from the same state as the server.
+	int32 RandomHelper(int32 Max)
+	{
+		const int32 Value = RandomStream.RandHelper(Max);
+		RandomStreamState = RandomStream.GetCurrentSeed();
+		return Value;
+	}
+	float GetRandomFraction()
+	{
+		const float Value = RandomStream.GetFraction();
+		RandomStreamState = RandomStream.GetCurrentSeed();
+		return Value;
+	}
+	const FRandomStream& GetRandomStream() const { return RandomStream; }
+
+	// Seeds the random selector nodes of this context, set it before starting the context for deterministic replays and tests
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Context")
+	void SetRandomSeed(int32 Seed)
+	{
+		RandomSeed = Seed;
+		RandomStream.Initialize(Seed);
+		RandomStreamState = Seed;
+	}
+
+	UFUNCTION(BlueprintPure, Category = "Dialogue|Context")
+	int32 GetRandomSeed() const { return RandomSeed; }
+
+	/**
+	 * Enters the first satisfied child of the start nodes like Start, but only to read the node it ends up in (selectors and proxies are followed).
+	 * The enter events are fired, the options of the node are not evaluated, its assets are not loaded and the context is not registered.
+	 * The context is left empty afterwards, so the same context can evaluate any number of barks, see UDlgManager::EvaluateBark.
+	 * @param bRecordHistory Should the entered nodes be added to the dialogue memory? Needed only if the conditions check the visited nodes.
+	 * @return OutResult.bValid
+	 */
+	bool EvaluateBark(UDlgDialogue* InDialogue, UObject* Participant, bool bRecordHistory, FDlgBarkResult& OutResult);
+
+	// Is this context evaluating a bark right now?
+	bool IsEvaluatingBark() const { return bEvaluatingBark; }
 
 	// Initializes/Starts the context, the first (start) node is selected and the first valid child node is entered.
 	// Called by the UDlgManager which creates the context
@@ -574,6 +760,23 @@ public:
 
 protected:
 	// bool StartInternal(UDlgDialogue* InDialogue, const TMap<FName, UObject*>& InParticipants, bool bLog, FString& OutErrorMessage);
+
+	// Streams the soft referenced assets of the active node, the assets of the previous node are released
+	void LoadActiveNodeAssets();
+	void ReleaseActiveNodeAssets();
+
+	// Resolves the memory returned by GetMemory, called when the context is started
+	void BindMemory(const UObject* WorldContextObject);
+
+	// Calls OnLoaded with the asset at AssetPath once it is loaded
+	static void LoadAssetAsync(const FSoftObjectPath& AssetPath, const FDlgOnActiveNodeAssetLoaded& OnLoaded);
+
+	// Marks the dialogue as ended, nothing is active anymore
+	void EndDialogue()
+	{
+		bDialogueEnded = true;
+		ReleaseActiveNodeAssets();
+	}
 	void LogErrorWithContext(const FString& ErrorMessage) const;
 	FString GetErrorMessageWithContext(const FString& ErrorMessage) const;
 
@@ -583,6 +786,12 @@ protected:
 		SerializeParticipants();
 	}
 
+public:
+	// Called once for each participant after the deferred enter events of a node modified its values
+	// Only used if UDlgSystemSettings::bDeferNodeEnterEvents is enabled
+	UPROPERTY(BlueprintAssignable, Category = "Dialogue|Context")
+	FDlgOnParticipantValuesChanged OnParticipantValuesChanged;
+
 protected:
 	// Current Dialogue used in this context at runtime.
 	UPROPERTY(Replicated)
@@ -592,6 +801,15 @@ protected:
 	UPROPERTY(Replicated, ReplicatedUsing = OnRep_SerializedParticipants)
 	TArray<UObject*> SerializedParticipants;
 
+	// Initial seed of the RandomStream, random by default, see SetRandomSeed
+	UPROPERTY(Replicated)
+	int32 RandomSeed = FMath::Rand();
+
+	// The current seed of the RandomStream, updated after each pick. Not only the initial seed is replicated, the server
+	// may have already picked (e.g. the selectors after the start node) by the time the client receives it
+	UPROPERTY(Replicated, ReplicatedUsing = OnRep_RandomStreamState)
+	int32 RandomStreamState = RandomSeed;
+
 	// All object is expected to implement the IDlgDialogueParticipant interface
 	// the key is the return value of IDlgDialogueParticipant::GetParticipantName()
 	UPROPERTY()
@@ -616,4 +834,50 @@ protected:
 
 	// cache the result of the last ChooseOption call
 	bool bDialogueEnded = false;
+
+	// Loop guards, see FDlgNodeStepStamps
+	FDlgNodeStepStamps EnteredNodesStamps;
+	FDlgNodeStepStamps VirtualParentStamps;
+	mutable FDlgNodeStepStamps EvaluationPathStamps;
+
+	// The HasNodeAnySatisfiedChild results of the current ReevaluateOptions pass, a step is a pass
+	mutable FDlgNodeStepStamps SatisfiedChildStamps;
+	mutable TBitArray<> SatisfiedChildResults;
+
+	// The memory bound by BindMemory, the global memory is used if the subsystem is not valid
+	TWeakObjectPtr<class UDlgMemorySubsystem> MemorySubsystem;
+	bool bMemoryBound = false;
+
+	// Keeps the soft referenced assets of the active node loaded
+	TSharedPtr<FStreamableHandle> ActiveNodeAssetsHandle;
+
+	// Loads the soft referenced assets of the nodes ahead of the active node
+	FDlgAssetPrefetcher AssetPrefetcher;
+
+	// The deferred enter events of the node being entered
+	FDlgEventCommandBuffer EventCommandBuffer;
+
+	// Initialized from the RandomSeed declared above, see SetRandomSeed
+	FRandomStream RandomStream = FRandomStream(RandomSeed);
+
+	// See EvaluateBark
+	bool bEvaluatingBark = false;
+	bool bBarkRecordHistory = false;
+
+	friend struct FDlgEvaluationPathScope;
+};
+
+// Starts a new evaluation path of the node enter conditions for the lifetime of the scope.
+// The SourceNode (if any) is already on the path, so the conditions looping back to it are not evaluated again.
+struct DLGSYSTEM_API FDlgEvaluationPathScope
+{
+public:
+	FDlgEvaluationPathScope(const UDlgContext& Context, const UDlgNode* SourceNode = nullptr);
+	~FDlgEvaluationPathScope();
+
+private:
+	FDlgNodeStepStamps& Stamps;
+	uint32 PreviousStep = 0;
+	int32 SourceNodeIndex = INDEX_NONE;
+	uint32 SourcePreviousStamp = 0;
 };
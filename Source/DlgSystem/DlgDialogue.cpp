@@ -3,11 +3,17 @@
 
 #include "UObject/DevObjectVersion.h"
 #include "HAL/FileManager.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
 #include "Misc/Paths.h"
 
 #if WITH_EDITOR
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphSchema.h"
+#if NY_ENGINE_VERSION >= 503
+#include "Misc/DataValidation.h"
+#endif
 #endif
 
 #include "DlgSystemModule.h"
@@ -15,12 +21,15 @@
 #include "IO/DlgConfigWriter.h"
 #include "IO/DlgJsonWriter.h"
 #include "IO/DlgJsonParser.h"
+#include "IO/DlgTextFileExporter.h"
 #include "Nodes/DlgNode_Speech.h"
 #include "Nodes/DlgNode_End.h"
 #include "Nodes/DlgNode_Start.h"
 #include "DlgManager.h"
 #include "Logging/DlgLogger.h"
 #include "DlgHelper.h"
+#include "DlgRuntimeStats.h"
+#include "DlgDialogueValidator.h"
 
 #define LOCTEXT_NAMESPACE "DlgDialogue"
 
@@ -78,6 +87,12 @@ void UDlgDialogue::Serialize(FArchive& Ar)
 		// No Longer supported
 		return;
 	}
+
+	// Undo/redo restores the Nodes but not the transient lookup
+	if (Ar.IsLoading() && Ar.IsTransacting())
+	{
+		RebuildNodeGUIDLookup();
+	}
 }
 
 void UDlgDialogue::PostLoad()
@@ -127,6 +142,8 @@ void UDlgDialogue::PostLoad()
 		);
 	}
 
+	RebuildNodeGUIDLookup();
+
 #if WITH_EDITOR
 	const bool bHasDialogueEditorModule = GetDialogueEditorAccess().IsValid();
 	// If this is false it means the graph nodes are not even created? Check for old files that were saved
@@ -172,12 +189,27 @@ void UDlgDialogue::PostLoad()
 	}
 
 	bWasLoaded = true;
+
+	if (FPlatformProperties::RequiresCookedData() && GetDefault<UDlgSystemSettings>()->bCompactCookedDialogues)
+	{
+#if UE_BUILD_SHIPPING
+		CompactRuntimeData();
+#else
+		const int64 SavedBytes = CompactRuntimeData(true);
+		FDlgLogger::Get().Debugf(TEXT("Compacted Dialogue = `%s`, saved %lld bytes"), *GetPathName(), SavedBytes);
+#endif
+	}
 }
 
 void UDlgDialogue::PostInitProperties()
 {
 	Super::PostInitProperties();
 
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		FDlgRuntimeStats::Get().AddLoadedDialogue();
+	}
+
 	// Ignore these cases
 	if (HasAnyFlags(RF_ClassDefaultObject | RF_NeedLoad))
 	{
@@ -209,6 +241,16 @@ void UDlgDialogue::PostInitProperties()
 	}
 }
 
+void UDlgDialogue::BeginDestroy()
+{
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		FDlgRuntimeStats::Get().RemoveLoadedDialogue();
+	}
+
+	Super::BeginDestroy();
+}
+
 void UDlgDialogue::PostRename(UObject* OldOuter, const FName OldName)
 {
 	Super::PostRename(OldOuter, OldName);
@@ -219,6 +261,12 @@ void UDlgDialogue::PostDuplicate(bool bDuplicateForPIE)
 {
 	Super::PostDuplicate(bDuplicateForPIE);
 
+	// Transient copies are never saved, they keep the GUID of the original (e.g. measuring the compaction)
+	if (HasAnyFlags(RF_Transient))
+	{
+		return;
+	}
+
 	// Used when duplicating dialogues.
 	// Make new guid for this copied Dialogue.
 	RegenerateGUID();
@@ -265,6 +313,39 @@ bool UDlgDialogue::Modify(bool bAlwaysMarkDirty)
 	return bWasSaved;
 }
 
+#if NY_ENGINE_VERSION >= 503
+EDataValidationResult UDlgDialogue::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+#else
+EDataValidationResult UDlgDialogue::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+#endif
+
+	const FDlgValidationResult ValidationResult = FDlgDialogueValidator::Validate(*this);
+	for (const FString& Error : ValidationResult.Errors)
+	{
+#if NY_ENGINE_VERSION >= 503
+		Context.AddError(FText::FromString(Error));
+#else
+		ValidationErrors.Add(FText::FromString(Error));
+#endif
+	}
+#if NY_ENGINE_VERSION >= 503
+	for (const FString& Warning : ValidationResult.Warnings)
+	{
+		Context.AddWarning(FText::FromString(Warning));
+	}
+#endif
+
+	if (!ValidationResult.IsValid())
+	{
+		return EDataValidationResult::Invalid;
+	}
+	return Result == EDataValidationResult::NotValidated ? EDataValidationResult::Valid : Result;
+}
+
 void UDlgDialogue::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
@@ -419,9 +500,27 @@ void UDlgDialogue::CompileDialogueNodesFromGraphNodes()
 		return;
 	}
 
+	// Compiled once at the end
+	if (DeferCompileDialogueCount > 0)
+	{
+		bCompileDialoguePending = true;
+		return;
+	}
+
 	FDlgLogger::Get().Infof(TEXT("Compiling Dialogue = `%s` (Graph data -> Dialogue data)`"), *GetPathName());
 	GetDialogueEditorAccess()->CompileDialogueNodesFromGraphNodes(this);
 }
+
+void UDlgDialogue::EndDeferCompileDialogue()
+{
+	check(DeferCompileDialogueCount > 0);
+	DeferCompileDialogueCount--;
+	if (DeferCompileDialogueCount == 0 && bCompileDialoguePending)
+	{
+		bCompileDialoguePending = false;
+		CompileDialogueNodesFromGraphNodes();
+	}
+}
 #endif // #if WITH_EDITOR
 
 void UDlgDialogue::ImportFromFile()
@@ -439,6 +538,9 @@ void UDlgDialogue::ImportFromFile()
 
 void UDlgDialogue::ImportFromFileFormat(EDlgDialogueTextFormat TextFormat)
 {
+	// Read what the last save wrote
+	FDlgTextFileExporter::Get().Flush();
+
 	const bool bHasExtension = UDlgSystemSettings::HasTextFileExtension(TextFormat);
 	const FString& TextFileName = GetTextFilePathName(TextFormat);
 
@@ -539,6 +641,7 @@ void UDlgDialogue::ImportFromFileFormat(EDlgDialogueTextFormat TextFormat)
 	}
 
 	Name = GetDialogueFName();
+	RebuildNodeGUIDLookup();
 	UpdateAndRefreshData(true);
 }
 
@@ -549,11 +652,80 @@ void UDlgDialogue::OnPreAssetSaved()
 	CompileDialogueNodesFromGraphNodes();
 #endif
 
+	// Convert before the export, the text file stores both the hard and the soft references
+	ConvertNodesAssetReferences(GetDefault<UDlgSystemSettings>()->bUseSoftReferencesForNodeAssets);
+
 	// Save file, dialogue data -> text file (.dlg)
 	UpdateAndRefreshData(true);
 	ExportToFile();
 }
 
+void UDlgDialogue::ConvertNodesAssetReferences(bool bToSoftReferences)
+{
+	for (UDlgNode* StartNode : StartNodes)
+	{
+		if (StartNode)
+		{
+			StartNode->ConvertNodeAssetReferences(bToSoftReferences);
+		}
+	}
+	for (UDlgNode* Node : Nodes)
+	{
+		if (Node)
+		{
+			Node->ConvertNodeAssetReferences(bToSoftReferences);
+		}
+	}
+}
+
+int64 UDlgDialogue::CompactRuntimeData(bool bMeasureSavedBytes)
+{
+	auto GetAllocatedSize = [this]() -> int64
+	{
+		FArchiveCountMem DialogueCount(this);
+		int64 Size = DialogueCount.GetMax();
+		for (UDlgNode* Node : StartNodes)
+		{
+			Size += FArchiveCountMem(Node).GetMax();
+		}
+		for (UDlgNode* Node : Nodes)
+		{
+			Size += FArchiveCountMem(Node).GetMax();
+		}
+		return Size;
+	};
+	const int64 SizeBefore = bMeasureSavedBytes ? GetAllocatedSize() : 0;
+
+	// The participants are still needed to validate the started contexts
+	for (auto& Elem : ParticipantsData)
+	{
+		Elem.Value.Empty();
+	}
+	ParticipantsData.Shrink();
+	AllSpeakerStates.Empty();
+	NodesGUIDToIndexMap.Empty();
+	SortedNodeGUIDs.Shrink();
+	SortedNodeIndices.Shrink();
+
+	TMap<FString, FText> SharedTexts;
+	for (UDlgNode* StartNode : StartNodes)
+	{
+		if (StartNode)
+		{
+			StartNode->CompactRuntimeData(SharedTexts);
+		}
+	}
+	for (UDlgNode* Node : Nodes)
+	{
+		if (Node)
+		{
+			Node->CompactRuntimeData(SharedTexts);
+		}
+	}
+
+	return bMeasureSavedBytes ? SizeBefore - GetAllocatedSize() : 0;
+}
+
 void UDlgDialogue::ExportToFile() const
 {
 	const EDlgDialogueTextFormat TextFormat = GetDefault<UDlgSystemSettings>()->DialogueTextFormat;
@@ -582,14 +754,14 @@ void UDlgDialogue::ExportToFileFormat(EDlgDialogueTextFormat TextFormat) const
 		{
 			FDlgJsonWriter JsonWriter;
 			JsonWriter.Write(GetClass(), this);
-			JsonWriter.ExportToFile(TextFileName);
+			ExportWriterToFile(JsonWriter, TextFileName);
 			break;
 		}
 		case EDlgDialogueTextFormat::DialogueDEPRECATED:
 		{
 			FDlgConfigWriter DlgWriter(TEXT("Dlg"));
 			DlgWriter.Write(GetClass(), this);
-			DlgWriter.ExportToFile(TextFileName);
+			ExportWriterToFile(DlgWriter, TextFileName);
 			break;
 		}
 		case EDlgDialogueTextFormat::All:
@@ -612,54 +784,221 @@ void UDlgDialogue::ExportToFileFormat(EDlgDialogueTextFormat TextFormat) const
 	}
 }
 
-FDlgParticipantData& UDlgDialogue::GetParticipantDataEntry(FName ParticipantName, FName FallbackParticipantName, bool bCheckNone, const FString& ContextMessage)
+void UDlgDialogue::ExportWriterToFile(IDlgWriter& Writer, const FString& TextFileName)
 {
-	// Used to ignore some participants
-	static FDlgParticipantData BlackHoleParticipant;
-
-	// If the Participant Name is not set, it adopts the Node Owner Name
-	const FName& ValidParticipantName = ParticipantName == NAME_None ? FallbackParticipantName : ParticipantName;
-
-	// Parent/child is not valid, simply do nothing
-	if (bCheckNone && ValidParticipantName == NAME_None)
+	if (GetDefault<UDlgSystemSettings>()->bExportTextFilesAsync)
 	{
-		FDlgLogger::Get().Warningf(
-			TEXT("Ignoring ParticipantName = None, Context = `%s`. Either your node participant name is None or your participant name is None."),
-			*ContextMessage
-		);
-		return BlackHoleParticipant;
+		// Only the write happens in the background, the writer already read the Dialogue
+		FString Contents = Writer.GetAsString();
+		FDlgTextFileExporter::Get().WriteAsync(TextFileName, MoveTemp(Contents));
+	}
+	else
+	{
+		Writer.ExportToFile(TextFileName);
 	}
-
-	return ParticipantsData.FindOrAdd(ValidParticipantName);
 }
 
-void UDlgDialogue::AddConditionsDataFromNodeEdges(const UDlgNode* Node, int32 NodeIndex)
+void UDlgDialogue::GatherNodeParticipantsData(const UDlgNode& Node, int32 NodeIndex, FDlgNodeParticipantsData& OutData)
 {
-	const FString NodeContext = FString::Printf(TEXT("Node %s"), NodeIndex > INDEX_NONE ? *FString::FromInt(NodeIndex) : TEXT("Start") );
-	const FName FallbackParticipantName = Node->GetNodeParticipantName();
+	const FName NodeParticipantName = Node.GetNodeParticipantName();
 
-	for (const FDlgEdge& Edge : Node->GetNodeChildren())
+	// The context message is only built if the participant is ignored
+	auto GetEntry = [&OutData, NodeParticipantName, NodeIndex](FName ParticipantName, const TCHAR* DataName, int32 TargetIndex) -> FDlgParticipantData*
 	{
-		const int32 TargetIndex = Edge.TargetIndex;
+		FDlgParticipantData* Data = OutData.FindOrAdd(ParticipantName, NodeParticipantName);
+		if (!Data)
+		{
+			const FString NodeContext = NodeIndex > INDEX_NONE ? FString::FromInt(NodeIndex) : TEXT("Start");
+			const FString ContextMessage = TargetIndex > INDEX_NONE
+				? FString::Printf(TEXT("Adding Edge %s from Node %s to Node %d"), DataName, *NodeContext, TargetIndex)
+				: FString::Printf(TEXT("Adding %s for Node %s"), DataName, *NodeContext);
+			FDlgLogger::Get().Warningf(
+				TEXT("Ignoring ParticipantName = None, Context = `%s`. Either your node participant name is None or your participant name is None."),
+				*ContextMessage
+			);
+		}
+		return Data;
+	};
 
+	// Edge conditions, the only data of the start nodes
+	for (const FDlgEdge& Edge : Node.GetNodeChildren())
+	{
+		if (!Edge.WeightParticipantName.IsNone() && !Edge.WeightFloatName.IsNone())
+		{
+			if (FDlgParticipantData* Data = GetEntry(Edge.WeightParticipantName, TEXT("weight"), Edge.TargetIndex))
+			{
+				Data->FloatVariableNames.Add(Edge.WeightFloatName);
+			}
+		}
 		for (const FDlgCondition& Condition : Edge.Conditions)
 		{
 			if (Condition.IsParticipantInvolved())
 			{
-				const FString ContextMessage = FString::Printf(TEXT("Adding Edge primary condition data from %s to Node %d"), *NodeContext, TargetIndex);
-				GetParticipantDataEntry(Condition.ParticipantName, FallbackParticipantName, true, ContextMessage)
-					.AddConditionPrimaryData(Condition);
+				if (FDlgParticipantData* Data = GetEntry(Condition.ParticipantName, TEXT("primary condition data"), Edge.TargetIndex))
+				{
+					Data->AddConditionPrimaryData(Condition);
+				}
 			}
 			if (Condition.IsSecondParticipantInvolved())
 			{
-				const FString ContextMessage = FString::Printf(TEXT("Adding Edge secondary condition data from %s to Node %d"), *NodeContext, TargetIndex);
-				GetParticipantDataEntry(Condition.OtherParticipantName, FallbackParticipantName, true, ContextMessage)
-					.AddConditionSecondaryData(Condition);
+				if (FDlgParticipantData* Data = GetEntry(Condition.OtherParticipantName, TEXT("secondary condition data"), Edge.TargetIndex))
+				{
+					Data->AddConditionSecondaryData(Condition);
+				}
+			}
+		}
+	}
+	if (NodeIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// participant names
+	TArray<FName> Participants;
+	Node.GetAssociatedParticipants(Participants);
+	for (const FName& Participant : Participants)
+	{
+		OutData.ParticipantsData.FindOrAdd(Participant);
+	}
+
+	// gather SpeakerStates
+	Node.AddAllSpeakerStatesIntoSet(OutData.SpeakerStates);
+
+	// Conditions from nodes
+	for (const FDlgCondition& Condition : Node.GetNodeEnterConditions())
+	{
+		if (Condition.IsParticipantInvolved())
+		{
+			if (FDlgParticipantData* Data = GetEntry(Condition.ParticipantName, TEXT("primary condition data"), INDEX_NONE))
+			{
+				Data->AddConditionPrimaryData(Condition);
+			}
+		}
+		if (Condition.IsSecondParticipantInvolved())
+		{
+			if (FDlgParticipantData* Data = GetEntry(Condition.OtherParticipantName, TEXT("secondary condition data"), INDEX_NONE))
+			{
+				Data->AddConditionSecondaryData(Condition);
 			}
 		}
 	}
+
+	// Walk over edges of speaker nodes
+	// NOTE: for speaker sequence nodes, the inner edges are handled by AddAllSpeakerStatesIntoSet
+	// so no need to special case handle it
+	for (const FDlgEdge& Edge : Node.GetNodeChildren())
+	{
+		// Speaker states
+		OutData.SpeakerStates.Add(Edge.SpeakerState);
+
+		// Text arguments are rebuild from the Node
+		for (const FDlgTextArgument& TextArgument : Edge.GetTextArguments())
+		{
+			if (FDlgParticipantData* Data = GetEntry(TextArgument.ParticipantName, TEXT("text arguments data"), Edge.TargetIndex))
+			{
+				Data->AddTextArgumentData(TextArgument);
+			}
+		}
+	}
+
+	// Events
+	for (const FDlgEvent& Event : Node.GetNodeEnterEvents())
+	{
+		if (FDlgParticipantData* Data = GetEntry(Event.ParticipantName, TEXT("events data"), INDEX_NONE))
+		{
+			Data->AddEventData(Event);
+		}
+	}
+
+	// Text arguments
+	for (const FDlgTextArgument& TextArgument : Node.GetTextArguments())
+	{
+		if (FDlgParticipantData* Data = GetEntry(TextArgument.ParticipantName, TEXT("text arguments data"), INDEX_NONE))
+		{
+			Data->AddTextArgumentData(TextArgument);
+		}
+	}
+
+	// Remove default values
+	OutData.SpeakerStates.Remove(FName(NAME_None));
+}
+
+void UDlgDialogue::AddNodeParticipantsData(const FDlgNodeParticipantsData& NodeData)
+{
+	for (const auto& Elem : NodeData.ParticipantsData)
+	{
+		const FName ParticipantName = Elem.Key;
+		FDlgParticipantData& ParticipantData = ParticipantsData.FindOrAdd(ParticipantName);
+#if WITH_EDITORONLY_DATA
+		ParticipantsRefCounts.FindOrAdd(ParticipantName)++;
+		Elem.Value.ForEachEntry([this, ParticipantName, &ParticipantData](int32 SetIndex, FName Name, UClass* Class)
+		{
+			int32& RefCount = ParticipantsDataRefCounts.FindOrAdd(FDlgParticipantDataEntry(ParticipantName, SetIndex, Name, Class));
+			if (RefCount++ == 0)
+			{
+				ParticipantData.AddEntry(SetIndex, Name, Class);
+			}
+		});
+#else
+		Elem.Value.ForEachEntry([&ParticipantData](int32 SetIndex, FName Name, UClass* Class)
+		{
+			ParticipantData.AddEntry(SetIndex, Name, Class);
+		});
+#endif // WITH_EDITORONLY_DATA
+	}
+
+	for (const FName& SpeakerState : NodeData.SpeakerStates)
+	{
+		AllSpeakerStates.Add(SpeakerState);
+#if WITH_EDITORONLY_DATA
+		SpeakerStatesRefCounts.FindOrAdd(SpeakerState)++;
+#endif
+	}
 }
 
+#if WITH_EDITORONLY_DATA
+void UDlgDialogue::RemoveNodeParticipantsData(const FDlgNodeParticipantsData& NodeData)
+{
+	for (const auto& Elem : NodeData.ParticipantsData)
+	{
+		const FName ParticipantName = Elem.Key;
+		FDlgParticipantData* ParticipantData = ParticipantsData.Find(ParticipantName);
+		if (!ParticipantData)
+		{
+			continue;
+		}
+
+		Elem.Value.ForEachEntry([this, ParticipantName, ParticipantData](int32 SetIndex, FName Name, UClass* Class)
+		{
+			const FDlgParticipantDataEntry Entry(ParticipantName, SetIndex, Name, Class);
+			int32* RefCount = ParticipantsDataRefCounts.Find(Entry);
+			if (RefCount && --(*RefCount) <= 0)
+			{
+				ParticipantsDataRefCounts.Remove(Entry);
+				ParticipantData->RemoveEntry(SetIndex, Name, Class);
+			}
+		});
+
+		int32* RefCount = ParticipantsRefCounts.Find(ParticipantName);
+		if (RefCount && --(*RefCount) <= 0)
+		{
+			ParticipantsRefCounts.Remove(ParticipantName);
+			ParticipantsData.Remove(ParticipantName);
+		}
+	}
+
+	for (const FName& SpeakerState : NodeData.SpeakerStates)
+	{
+		int32* RefCount = SpeakerStatesRefCounts.Find(SpeakerState);
+		if (RefCount && --(*RefCount) <= 0)
+		{
+			SpeakerStatesRefCounts.Remove(SpeakerState);
+			AllSpeakerStates.Remove(SpeakerState);
+		}
+	}
+}
+#endif // WITH_EDITORONLY_DATA
+
 void UDlgDialogue::RebuildAndUpdateNode(UDlgNode* Node, const UDlgSystemSettings& Settings, bool bUpdateTextsNamespacesAndKeys)
 {
 	static constexpr bool bEdges = true;
@@ -685,99 +1024,68 @@ void UDlgDialogue::UpdateAndRefreshData(bool bUpdateTextsNamespacesAndKeys)
 	const UDlgSystemSettings* Settings = GetDefault<UDlgSystemSettings>();
 	ParticipantsData.Empty();
 	AllSpeakerStates.Empty();
+#if WITH_EDITORONLY_DATA
+	NodesParticipantsData.Empty(StartNodes.Num() + Nodes.Num());
+	ParticipantsDataRefCounts.Empty();
+	ParticipantsRefCounts.Empty();
+	SpeakerStatesRefCounts.Empty();
+#endif
 
 	// do not forget about the edges of the Root/Start Node
-	for (UDlgNode* StartNode : StartNodes)
-	{
-		AddConditionsDataFromNodeEdges(StartNode, INDEX_NONE);
-		RebuildAndUpdateNode(StartNode, *Settings, bUpdateTextsNamespacesAndKeys);
-	}
-
-	// Regular Nodes
+	const int32 StartNodesNum = StartNodes.Num();
 	const int32 NodesNum = Nodes.Num();
-	for (int32 NodeIndex = 0; NodeIndex < NodesNum; NodeIndex++)
+	for (int32 Index = 0; Index < StartNodesNum + NodesNum; Index++)
 	{
-		const FString NodeContext = FString::Printf(TEXT("Node %d"), NodeIndex);
-		UDlgNode* Node = Nodes[NodeIndex];
-		const FName NodeParticipantName = Node->GetNodeParticipantName();
+		const bool bStartNode = Index < StartNodesNum;
+		const int32 NodeIndex = bStartNode ? INDEX_NONE : Index - StartNodesNum;
+		UDlgNode* Node = bStartNode ? StartNodes[Index] : Nodes[NodeIndex];
 
 		// Rebuild & Update
 		RebuildAndUpdateNode(Node, *Settings, bUpdateTextsNamespacesAndKeys);
 
-		// participant names
-		TArray<FName> Participants;
-		Node->GetAssociatedParticipants(Participants);
-		for (const FName& Participant : Participants)
-		{
-			if (!ParticipantsData.Contains(Participant))
-			{
-				ParticipantsData.Add(Participant);
-			}
-		}
-
-		// gather SpeakerStates
-		Node->AddAllSpeakerStatesIntoSet(AllSpeakerStates);
-
-		// Conditions from nodes
-		for (const FDlgCondition& Condition : Node->GetNodeEnterConditions())
-		{
-			if (Condition.IsParticipantInvolved())
-			{
-				const FString ContextMessage = FString::Printf(TEXT("Adding primary condition data for %s"), *NodeContext);
-				GetParticipantDataEntry(Condition.ParticipantName, NodeParticipantName, true, ContextMessage)
-					.AddConditionPrimaryData(Condition);
-			}
-			if (Condition.IsSecondParticipantInvolved())
-			{
-				const FString ContextMessage = FString::Printf(TEXT("Adding secondary condition data for %s"), *NodeContext);
-				GetParticipantDataEntry(Condition.OtherParticipantName, NodeParticipantName, true, ContextMessage)
-					.AddConditionSecondaryData(Condition);
-			}
-		}
-
-		// Gather Edge Data
-		AddConditionsDataFromNodeEdges(Node, NodeIndex);
+#if WITH_EDITORONLY_DATA
+		FDlgNodeParticipantsData& NodeData = NodesParticipantsData.Add(Node);
+#else
+		FDlgNodeParticipantsData NodeData;
+#endif
+		GatherNodeParticipantsData(*Node, NodeIndex, NodeData);
+		AddNodeParticipantsData(NodeData);
+	}
 
-		// Walk over edges of speaker nodes
-		// NOTE: for speaker sequence nodes, the inner edges are handled by AddAllSpeakerStatesIntoSet
-		// so no need to special case handle it
-		const int32 NumNodeChildren = Node->GetNumNodeChildren();
-		for (int32 EdgeIndex = 0; EdgeIndex < NumNodeChildren; EdgeIndex++)
-		{
-			const FDlgEdge& Edge = Node->GetNodeChildAt(EdgeIndex);
-			const int32 TargetIndex = Edge.TargetIndex;
+	UpdateParticipantsClasses();
+}
 
-			// Speaker states
-			AllSpeakerStates.Add(Edge.SpeakerState);
+void UDlgDialogue::UpdateAndRefreshNodeData(UDlgNode* Node, bool bUpdateTextsNamespacesAndKeys)
+{
+#if WITH_EDITORONLY_DATA
+	// Nodes were added or removed since the last full refresh
+	FDlgNodeParticipantsData* NodeData = Node ? NodesParticipantsData.Find(Node) : nullptr;
+	if (!NodeData || NodesParticipantsData.Num() != StartNodes.Num() + Nodes.Num())
+	{
+		UpdateAndRefreshData(bUpdateTextsNamespacesAndKeys);
+		return;
+	}
 
-			// Text arguments are rebuild from the Node
-			for (const FDlgTextArgument& TextArgument : Edge.GetTextArguments())
-			{
-				const FString ContextMessage = FString::Printf(TEXT("Adding Edge text arguments data from %s, to Node %d"), *NodeContext, TargetIndex);
-				GetParticipantDataEntry(TextArgument.ParticipantName, NodeParticipantName, true, ContextMessage)
-					.AddTextArgumentData(TextArgument);
-			}
-		}
+	const UDlgSystemSettings* Settings = GetDefault<UDlgSystemSettings>();
+	RebuildAndUpdateNode(Node, *Settings, bUpdateTextsNamespacesAndKeys);
 
-		// Events
-		for (const FDlgEvent& Event : Node->GetNodeEnterEvents())
-		{
-			const FString ContextMessage = FString::Printf(TEXT("Adding events data for %s"), *NodeContext);
-			GetParticipantDataEntry(Event.ParticipantName, NodeParticipantName, true, ContextMessage)
-				.AddEventData(Event);
-		}
+	// Retract the old data of the Node and add the new one
+	const int32 NodeIndex = StartNodes.Contains(Node) ? INDEX_NONE : Nodes.IndexOfByKey(Node);
+	RemoveNodeParticipantsData(*NodeData);
+	NodeData->ParticipantsData.Empty();
+	NodeData->SpeakerStates.Empty();
+	GatherNodeParticipantsData(*Node, NodeIndex, *NodeData);
+	AddNodeParticipantsData(*NodeData);
 
-		// Text arguments
-		for (const FDlgTextArgument& TextArgument : Node->GetTextArguments())
-		{
-			const FString ContextMessage = FString::Printf(TEXT("Adding text arguments data for %s"), *NodeContext);
-			GetParticipantDataEntry(TextArgument.ParticipantName, NodeParticipantName, true, ContextMessage)
-				.AddTextArgumentData(TextArgument);
-		}
-	}
+	UpdateParticipantsClasses();
+#else
+	UpdateAndRefreshData(bUpdateTextsNamespacesAndKeys);
+#endif // WITH_EDITORONLY_DATA
+}
 
-	// Remove default values
-	AllSpeakerStates.Remove(FName(NAME_None));
+void UDlgDialogue::UpdateParticipantsClasses()
+{
+	const UDlgSystemSettings* Settings = GetDefault<UDlgSystemSettings>();
 
 	//
 	// Fill ParticipantClasses
@@ -863,9 +1171,10 @@ FGuid UDlgDialogue::GetNodeGUIDForIndex(int32 NodeIndex) const
 
 int32 UDlgDialogue::GetNodeIndexForGUID(const FGuid& NodeGUID) const
 {
-	if (const int32* NodeIndexPtr = NodesGUIDToIndexMap.Find(NodeGUID))
+	const int32 Index = Algo::LowerBound(SortedNodeGUIDs, NodeGUID);
+	if (SortedNodeGUIDs.IsValidIndex(Index) && SortedNodeGUIDs[Index] == NodeGUID)
 	{
-		return *NodeIndexPtr;
+		return SortedNodeIndices[Index];
 	}
 
 	return INDEX_NONE;
@@ -880,10 +1189,7 @@ void UDlgDialogue::SetStartNodes(TArray<UDlgNode*> InStartNodes)
 void UDlgDialogue::SetNodes(const TArray<UDlgNode*>& InNodes)
 {
 	Nodes = InNodes;
-	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); NodeIndex++)
-	{
-		UpdateGUIDToIndexMap(Nodes[NodeIndex], NodeIndex);
-	}
+	RebuildNodeGUIDLookup();
 }
 
 void UDlgDialogue::SetNode(int32 NodeIndex, UDlgNode* InNode)
@@ -893,18 +1199,68 @@ void UDlgDialogue::SetNode(int32 NodeIndex, UDlgNode* InNode)
 		return;
 	}
 
+	// Patch the lookup instead of rebuilding it, the replaced Node does not own its GUID anymore
+	const UDlgNode* OldNode = Nodes[NodeIndex];
 	Nodes[NodeIndex] = InNode;
-	UpdateGUIDToIndexMap(InNode, NodeIndex);
+	if (OldNode && OldNode->HasGUID())
+	{
+		const int32 OldIndex = Algo::LowerBound(SortedNodeGUIDs, OldNode->GetGUID());
+		if (SortedNodeGUIDs.IsValidIndex(OldIndex) && SortedNodeGUIDs[OldIndex] == OldNode->GetGUID() && SortedNodeIndices[OldIndex] == NodeIndex)
+		{
+			SortedNodeGUIDs.RemoveAt(OldIndex);
+			SortedNodeIndices.RemoveAt(OldIndex);
+		}
+	}
+
+	// Same as for the duplicates in RebuildNodeGUIDLookup, the last Node set wins
+	if (InNode->HasGUID())
+	{
+		const int32 NewIndex = Algo::LowerBound(SortedNodeGUIDs, InNode->GetGUID());
+		if (SortedNodeGUIDs.IsValidIndex(NewIndex) && SortedNodeGUIDs[NewIndex] == InNode->GetGUID())
+		{
+			SortedNodeIndices[NewIndex] = NodeIndex;
+		}
+		else
+		{
+			SortedNodeGUIDs.Insert(InNode->GetGUID(), NewIndex);
+			SortedNodeIndices.Insert(NodeIndex, NewIndex);
+		}
+	}
 }
 
-void UDlgDialogue::UpdateGUIDToIndexMap(const UDlgNode* Node, int32 NodeIndex)
+void UDlgDialogue::RebuildNodeGUIDLookup()
 {
-	if (!Node || !IsValidNodeIndex(NodeIndex) || !Node->HasGUID())
+	// The old map is no longer used, the GUIDs are saved by the nodes
+	NodesGUIDToIndexMap.Empty();
+
+	TArray<TPair<FGuid, int32>> Pairs;
+	Pairs.Reserve(Nodes.Num());
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); NodeIndex++)
 	{
-		return;
+		const UDlgNode* Node = Nodes[NodeIndex];
+		if (Node && Node->HasGUID())
+		{
+			Pairs.Emplace(Node->GetGUID(), NodeIndex);
+		}
 	}
 
-	NodesGUIDToIndexMap.Add(Node->GetGUID(), NodeIndex);
+	// Stable, so the Nodes of a duplicate GUID stay in the order of their index
+	Algo::StableSortBy(Pairs, [](const TPair<FGuid, int32>& Pair) { return Pair.Key; });
+
+	// One entry for each GUID, the last Node of a duplicate GUID wins like it did in the old NodesGUIDToIndexMap
+	SortedNodeGUIDs.Empty(Pairs.Num());
+	SortedNodeIndices.Empty(Pairs.Num());
+	for (const TPair<FGuid, int32>& Pair : Pairs)
+	{
+		if (SortedNodeGUIDs.Num() > 0 && SortedNodeGUIDs.Last() == Pair.Key)
+		{
+			SortedNodeIndices.Last() = Pair.Value;
+			continue;
+		}
+
+		SortedNodeGUIDs.Add(Pair.Key);
+		SortedNodeIndices.Add(Pair.Value);
+	}
 }
 
 bool UDlgDialogue::IsEndNode(int32 NodeIndex) const
@@ -958,6 +1314,7 @@ bool UDlgDialogue::DeleteTextFileForExtension(const FString& FileExtension) cons
 	}
 
 	const FString FullPathName = TextFilePathName + FileExtension;
+	FDlgTextFileExporter::Get().Flush(FullPathName);
 	return FDlgHelper::DeleteFile(FullPathName);
 }
 
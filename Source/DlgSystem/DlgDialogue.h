@@ -113,6 +113,9 @@ public:
 	 */
 	void PostInitProperties() override;
 
+	/** Called before destroying the object. */
+	void BeginDestroy() override;
+
 	/** Executed after Rename is executed. */
 	void PostRename(UObject* OldOuter, FName OldName) override;
 
@@ -162,6 +165,13 @@ public:
 	 * @param Collector	FReferenceCollector objects to be used to collect references.
 	 */
 	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	/** Validates the Dialogue for the data validation of the editor, see FDlgDialogueValidator */
+#if NY_ENGINE_VERSION >= 503
+	EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+#else
+	EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
 #endif
 	// End UObject Interface.
 
@@ -233,8 +243,15 @@ public:
 	static TSharedPtr<IDlgEditorAccess> GetDialogueEditorAccess() { return DialogueEditorAccess; }
 
 	// Enables/disables the compilation of the dialogues in the editor, use with care. Mainly used for optimization.
+	// NOTE: the compilations requested while disabled are dropped, see BeginDeferCompileDialogue for bulk edits
 	void EnableCompileDialogue() { bCompileDialogue = true; }
 	void DisableCompileDialogue() { bCompileDialogue = false; }
+
+	// Defers the compilation of the dialogue until the matching EndDeferCompileDialogue, the calls can be nested.
+	// All the CompileDialogueNodesFromGraphNodes calls in between result in a single compilation at the end of the outermost one.
+	void BeginDeferCompileDialogue() { DeferCompileDialogueCount++; }
+	void EndDeferCompileDialogue();
+	bool IsCompileDialogueDeferred() const { return DeferCompileDialogueCount > 0; }
 #endif
 
 	// Construct and initialize a node within this Dialogue.
@@ -633,7 +650,12 @@ public:
 	// SetStartNode
 	// SetNodes
 	// After this
-	void EmptyNodesGUIDToIndexMap() { NodesGUIDToIndexMap.Empty(); }
+	void EmptyNodesGUIDToIndexMap()
+	{
+		NodesGUIDToIndexMap.Empty();
+		SortedNodeGUIDs.Empty();
+		SortedNodeIndices.Empty();
+	}
 
 	// Sets the Dialogue Nodes. Use with care.
 	void SetNodes(const TArray<UDlgNode*>& InNodes);
@@ -665,11 +687,25 @@ public:
 	// Exports this dialogue data into it's corresponding ".dlg" text file with the same name as this (Name).
 	void ExportToFile() const;
 
+	// Moves the voice and generic data of all nodes between the hard and soft references
+	// See UDlgSystemSettings::bUseSoftReferencesForNodeAssets
+	void ConvertNodesAssetReferences(bool bToSoftReferences);
+
+	// Strips the participant names (except the participants themselves) and speaker states used only by the editor and the name queries,
+	// shrinks the node arrays and shares the identical texts. Never call this on a Dialogue that is edited or saved afterwards.
+	// See UDlgSystemSettings::bCompactCookedDialogues
+	// @return the number of bytes saved, only measured if bMeasureSavedBytes is true
+	int64 CompactRuntimeData(bool bMeasureSavedBytes = false);
+
 	// Updates the data of some nodes
 	// Fills the DlgData with the updated data
 	// NOTE: this can do a dialogue data -> graph node data update
 	void UpdateAndRefreshData(bool bUpdateTextsNamespacesAndKeys = false);
 
+	// Same as UpdateAndRefreshData but only for the Node, only its participant data is retracted and added again
+	// Falls back to UpdateAndRefreshData if nodes were added or removed since the last refresh
+	void UpdateAndRefreshNodeData(UDlgNode* Node, bool bUpdateTextsNamespacesAndKeys = false);
+
 	// Adds a new node to this dialogue, returns the index location of the added node in the Nodes array.
 	int32 AddNode(UDlgNode* NodeToAdd) { return Nodes.Add(NodeToAdd); }
 
@@ -700,11 +736,17 @@ public:
 	static FString GetTextFilePathNameFromAssetPathName(const FString& AssetPathName);
 
 private:
-	// Adds conditions from the edges of this Node.
-	void AddConditionsDataFromNodeEdges(const UDlgNode* Node, int32 NodeIndex);
+	// Gathers the participant data of the Node and its edges, NodeIndex is INDEX_NONE for the start nodes (only their edges are gathered)
+	static void GatherNodeParticipantsData(const UDlgNode& Node, int32 NodeIndex, FDlgNodeParticipantsData& OutData);
 
-	// Gets the map entry - creates it first if it is not yet there
-	FDlgParticipantData& GetParticipantDataEntry(FName ParticipantName, FName FallbackParticipantName, bool bCheckNone, const FString& ContextMessage);
+	// Adds/Removes the data gathered from a node, the entries are reference counted in the editor
+	void AddNodeParticipantsData(const FDlgNodeParticipantsData& NodeData);
+#if WITH_EDITORONLY_DATA
+	void RemoveNodeParticipantsData(const FDlgNodeParticipantsData& NodeData);
+#endif
+
+	// Syncs the ParticipantsClasses with the ParticipantsData
+	void UpdateParticipantsClasses();
 
 	// Rebuild & Update and node and its edges
 	void RebuildAndUpdateNode(UDlgNode* Node, const UDlgSystemSettings& Settings, bool bUpdateTextsNamespacesAndKeys);
@@ -712,8 +754,11 @@ private:
 	void ImportFromFileFormat(EDlgDialogueTextFormat TextFormat);
 	void ExportToFileFormat(EDlgDialogueTextFormat TextFormat) const;
 
-	// Updates NodesGUIDToIndexMap with Node
-	void UpdateGUIDToIndexMap(const UDlgNode* Node, int32 NodeIndex);
+	// Writes the serialized Dialogue, on a background task if UDlgSystemSettings::bExportTextFilesAsync is enabled
+	static void ExportWriterToFile(class IDlgWriter& Writer, const FString& TextFileName);
+
+	// Rebuilds SortedNodeGUIDs and SortedNodeIndices from the Nodes
+	void RebuildNodeGUIDLookup();
 
 protected:
 	// Used to keep track of the version in text  file too, besides being written in the .uasset file.
@@ -740,6 +785,16 @@ protected:
 	UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category = "Dialogue", Meta = (DlgNoExport))
 	TSet<FName> AllSpeakerStates;
 
+#if WITH_EDITORONLY_DATA
+	// The participant data added by each node, see UpdateAndRefreshNodeData
+	TMap<const UDlgNode*, FDlgNodeParticipantsData> NodesParticipantsData;
+
+	// The number of nodes that added each entry of the ParticipantsData and AllSpeakerStates
+	TMap<FDlgParticipantDataEntry, int32> ParticipantsDataRefCounts;
+	TMap<FName, int32> ParticipantsRefCounts;
+	TMap<FName, int32> SpeakerStatesRefCounts;
+#endif
+
 	// Root node, Dialogue is started from the first child with satisfied condition (like the SelectorFirst node)
 	// NOTE: Add VisibleAnywhere to make it easier to debug
 	UPROPERTY(Instanced)
@@ -756,10 +811,17 @@ protected:
 	UPROPERTY(AdvancedDisplay, EditFixedSize, Instanced, Meta = (DlgWriteIndex))
 	TArray<UDlgNode*> Nodes;
 
-	// Maps Node GUID => Node Index
-	UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category = "Dialogue", DisplayName = "Nodes GUID To Index Map")
+	// DEPRECATED, the GUIDs are looked up in SortedNodeGUIDs. Only read from old assets and text files, emptied on load.
+	UPROPERTY(Meta = (DlgNoExport))
 	TMap<FGuid, int32> NodesGUIDToIndexMap;
 
+	// The unique GUIDs of the Nodes in ascending order, GetNodeIndexForGUID binary searches this.
+	// A GUID used by multiple Nodes maps to the last one, like NodesGUIDToIndexMap did.
+	// SortedNodeIndices[Index] is the Node Index of SortedNodeGUIDs[Index].
+	// Not serialized, the nodes already save their GUIDs, rebuilt by RebuildNodeGUIDLookup.
+	TArray<FGuid> SortedNodeGUIDs;
+	TArray<int32> SortedNodeIndices;
+
 	// Useful for syncing on the first run with the text file.
 	bool bIsSyncedWithTextFile = false;
 
@@ -774,6 +836,12 @@ protected:
 	// Flag used for optimization, used to enable/disable compiling of the dialogue for bulk operations.
 	bool bCompileDialogue = true;
 
+	// Number of BeginDeferCompileDialogue calls without a matching EndDeferCompileDialogue
+	int32 DeferCompileDialogueCount = 0;
+
+	// Was a compilation requested while it was deferred?
+	bool bCompileDialoguePending = false;
+
 	// Flag indicating if this Dialogue was compiled at least once in the current runtime.
 	bool bWasCompiledAtLeastOnce = false;
 
@@ -789,3 +857,28 @@ public:
 	UPROPERTY(EditAnywhere, AdvancedDisplay, Instanced, Category = "Asset User Data")
 	TArray<TObjectPtr<UAssetUserData>> AssetUserData;
 };
+
+#if WITH_EDITOR
+// Defers the compilation of the Dialogue until the end of the scope, see UDlgDialogue::BeginDeferCompileDialogue
+struct FDlgDeferCompileDialogueScope
+{
+public:
+	FDlgDeferCompileDialogueScope(UDlgDialogue* InDialogue) : Dialogue(InDialogue)
+	{
+		if (Dialogue)
+		{
+			Dialogue->BeginDeferCompileDialogue();
+		}
+	}
+	~FDlgDeferCompileDialogueScope()
+	{
+		if (Dialogue)
+		{
+			Dialogue->EndDeferCompileDialogue();
+		}
+	}
+
+private:
+	UDlgDialogue* Dialogue = nullptr;
+};
+#endif // WITH_EDITOR
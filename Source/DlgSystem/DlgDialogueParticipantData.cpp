@@ -6,8 +6,88 @@
 #include "DlgEvent.h"
 #include "DlgCondition.h"
 #include "DlgTextArgument.h"
+#include "NYEngineVersionHelpers.h"
+
+// The sets of FDlgParticipantData in the order of their SetIndex, the class sets come after the name sets
+static TSet<FName> FDlgParticipantData::* const ParticipantDataNameSets[] =
+{
+	&FDlgParticipantData::Conditions,
+	&FDlgParticipantData::Events,
+	&FDlgParticipantData::UnrealFunctions,
+	&FDlgParticipantData::IntVariableNames,
+	&FDlgParticipantData::FloatVariableNames,
+	&FDlgParticipantData::BoolVariableNames,
+	&FDlgParticipantData::NameVariableNames,
+	&FDlgParticipantData::ClassIntVariableNames,
+	&FDlgParticipantData::ClassFloatVariableNames,
+	&FDlgParticipantData::ClassBoolVariableNames,
+	&FDlgParticipantData::ClassNameVariableNames,
+	&FDlgParticipantData::ClassTextVariableNames
+};
+static TSet<UClass*> FDlgParticipantData::* const ParticipantDataClassSets[] =
+{
+	&FDlgParticipantData::CustomConditions,
+	&FDlgParticipantData::CustomEvents,
+	&FDlgParticipantData::CustomTextArguments
+};
+static constexpr int32 NumParticipantDataNameSets = NY_ARRAY_COUNT(ParticipantDataNameSets);
+static constexpr int32 NumParticipantDataClassSets = NY_ARRAY_COUNT(ParticipantDataClassSets);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgParticipantData::ForEachEntry(TFunctionRef<void(int32 SetIndex, FName Name, UClass* Class)> Callback) const
+{
+	for (int32 SetIndex = 0; SetIndex < NumParticipantDataNameSets; SetIndex++)
+	{
+		for (const FName Name : this->*ParticipantDataNameSets[SetIndex])
+		{
+			Callback(SetIndex, Name, nullptr);
+		}
+	}
+	for (int32 ClassSetIndex = 0; ClassSetIndex < NumParticipantDataClassSets; ClassSetIndex++)
+	{
+		for (UClass* Class : this->*ParticipantDataClassSets[ClassSetIndex])
+		{
+			Callback(NumParticipantDataNameSets + ClassSetIndex, NAME_None, Class);
+		}
+	}
+}
+
+void FDlgParticipantData::AddEntry(int32 SetIndex, FName Name, UClass* Class)
+{
+	if (SetIndex < NumParticipantDataNameSets)
+	{
+		(this->*ParticipantDataNameSets[SetIndex]).Add(Name);
+	}
+	else
+	{
+		(this->*ParticipantDataClassSets[SetIndex - NumParticipantDataNameSets]).Add(Class);
+	}
+}
+
+void FDlgParticipantData::RemoveEntry(int32 SetIndex, FName Name, UClass* Class)
+{
+	if (SetIndex < NumParticipantDataNameSets)
+	{
+		(this->*ParticipantDataNameSets[SetIndex]).Remove(Name);
+	}
+	else
+	{
+		(this->*ParticipantDataClassSets[SetIndex - NumParticipantDataNameSets]).Remove(Class);
+	}
+}
+
+void FDlgParticipantData::Empty()
+{
+	for (int32 SetIndex = 0; SetIndex < NumParticipantDataNameSets; SetIndex++)
+	{
+		(this->*ParticipantDataNameSets[SetIndex]).Empty();
+	}
+	for (int32 ClassSetIndex = 0; ClassSetIndex < NumParticipantDataClassSets; ClassSetIndex++)
+	{
+		(this->*ParticipantDataClassSets[ClassSetIndex]).Empty();
+	}
+}
+
 void FDlgParticipantData::AddConditionPrimaryData(const FDlgCondition& Condition)
 {
 	const EDlgConditionType ConditionType = Condition.ConditionType;
@@ -1,6 +1,8 @@
 // Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
 #pragma once
 
+#include "Templates/Function.h"
+
 #include "DlgDialogueParticipantData.generated.h"
 
 struct FDlgCondition;
@@ -20,6 +22,16 @@ public:
 	void AddEventData(const FDlgEvent& Event);
 	void AddTextArgumentData(const FDlgTextArgument& TextArgument);
 
+	// Calls Callback with each name and class of this data, the SetIndex identifies the set they are in
+	void ForEachEntry(TFunctionRef<void(int32 SetIndex, FName Name, UClass* Class)> Callback) const;
+
+	// Adds/Removes a single entry given by ForEachEntry
+	void AddEntry(int32 SetIndex, FName Name, UClass* Class);
+	void RemoveEntry(int32 SetIndex, FName Name, UClass* Class);
+
+	// Removes all the names and classes, frees their memory
+	void Empty();
+
 public:
 	// FName based conditions (aka conditions of type EventCall).
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Dialogue|Participant")
@@ -81,3 +93,49 @@ public:
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Dialogue|Participant")
 	TSet<FName> ClassTextVariableNames;
 };
+
+// Identifies a single name or class of the participant data, used to reference count the data added by the nodes
+struct DLGSYSTEM_API FDlgParticipantDataEntry
+{
+public:
+	FDlgParticipantDataEntry() {}
+	FDlgParticipantDataEntry(FName InParticipantName, int32 InSetIndex, FName InName, UClass* InClass)
+		: ParticipantName(InParticipantName), SetIndex(InSetIndex), Name(InName), Class(InClass) {}
+
+	bool operator==(const FDlgParticipantDataEntry& Other) const
+	{
+		return ParticipantName == Other.ParticipantName && SetIndex == Other.SetIndex && Name == Other.Name && Class == Other.Class;
+	}
+
+	friend uint32 GetTypeHash(const FDlgParticipantDataEntry& Entry)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Entry.ParticipantName), GetTypeHash(Entry.SetIndex));
+		Hash = HashCombine(Hash, GetTypeHash(Entry.Name));
+		return HashCombine(Hash, GetTypeHash(Entry.Class));
+	}
+
+public:
+	FName ParticipantName;
+
+	// See FDlgParticipantData::ForEachEntry
+	int32 SetIndex = INDEX_NONE;
+	FName Name;
+	UClass* Class = nullptr;
+};
+
+// The participant data added by a single node (and its edges), see UDlgDialogue::UpdateAndRefreshNodeData
+struct DLGSYSTEM_API FDlgNodeParticipantsData
+{
+public:
+	// Gets the entry of ParticipantName (FallbackParticipantName if it is None), creates it first if it is not yet there
+	// Returns nullptr if both are None
+	FDlgParticipantData* FindOrAdd(FName ParticipantName, FName FallbackParticipantName)
+	{
+		const FName ValidParticipantName = ParticipantName.IsNone() ? FallbackParticipantName : ParticipantName;
+		return ValidParticipantName.IsNone() ? nullptr : &ParticipantsData.FindOrAdd(ValidParticipantName);
+	}
+
+public:
+	TMap<FName, FDlgParticipantData> ParticipantsData;
+	TSet<FName> SpeakerStates;
+};
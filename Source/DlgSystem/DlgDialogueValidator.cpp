@@ -0,0 +1,292 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgDialogueValidator.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+#include "DlgDialogue.h"
+#include "DlgCondition.h"
+#include "DlgEvent.h"
+#include "DlgTextArgument.h"
+#include "Nodes/DlgNode.h"
+#include "Nodes/DlgNode_Speech.h"
+#include "Nodes/DlgNode_SpeechSequence.h"
+#include "Nodes/DlgNode_Proxy.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgValidationSnapshot
+FDlgValidationSnapshot FDlgValidationSnapshot::Create(const UDlgDialogue& Dialogue)
+{
+	check(IsInGameThread());
+	FDlgValidationSnapshot Snapshot;
+	Snapshot.DialoguePath = Dialogue.GetPathName();
+	Snapshot.DialogueGUID = Dialogue.HasGUID() ? Dialogue.GetGUID() : FGuid();
+
+	for (const UDlgNode* Node : Dialogue.GetStartNodes())
+	{
+		Snapshot.StartNodes.Add(Node ? CreateNode(*Node) : FDlgValidationNodeSnapshot());
+	}
+
+	const TArray<UDlgNode*>& Nodes = Dialogue.GetNodes();
+	Snapshot.Nodes.Reserve(Nodes.Num());
+	for (const UDlgNode* Node : Nodes)
+	{
+		Snapshot.Nodes.Add(Node ? CreateNode(*Node) : FDlgValidationNodeSnapshot());
+	}
+
+	return Snapshot;
+}
+
+FDlgValidationNodeSnapshot FDlgValidationSnapshot::CreateNode(const UDlgNode& Node)
+{
+	FDlgValidationNodeSnapshot NodeSnapshot;
+	NodeSnapshot.GUID = Node.GetGUID();
+	NodeSnapshot.NodeType = Node.GetClass()->GetName();
+
+	// Only the speech nodes need someone to say the text
+	if (Node.IsA<UDlgNode_Speech>())
+	{
+		NodeSnapshot.ParticipantName = Node.GetNodeParticipantName();
+		NodeSnapshot.bParticipantRequired = true;
+	}
+
+	AddConditions(TEXT("Enter Condition"), Node.GetNodeEnterConditions(), NodeSnapshot);
+	AddEvents(TEXT("Enter Event"), Node.GetNodeEnterEvents(), NodeSnapshot);
+	AddTextArguments(TEXT("Text Argument"), Node.GetTextArguments(), NodeSnapshot);
+
+	for (const FDlgEdge& Edge : Node.GetNodeChildren())
+	{
+		NodeSnapshot.TargetIndices.Add(Edge.TargetIndex);
+		AddConditions(TEXT("Edge Condition"), Edge.Conditions, NodeSnapshot);
+		AddTextArguments(TEXT("Edge Text Argument"), Edge.GetTextArguments(), NodeSnapshot);
+	}
+
+	if (const UDlgNode_Proxy* Proxy = Cast<UDlgNode_Proxy>(&Node))
+	{
+		NodeSnapshot.TargetIndices.Add(Proxy->GetTargetNodeIndex());
+	}
+
+	if (const UDlgNode_SpeechSequence* SpeechSequence = Cast<UDlgNode_SpeechSequence>(&Node))
+	{
+		const TArray<FDlgSpeechSequenceEntry>& Entries = SpeechSequence->GetNodeSpeechSequence();
+		for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+		{
+			FDlgValidationReferenceSnapshot& Reference = NodeSnapshot.References.AddDefaulted_GetRef();
+			Reference.Kind = TEXT("Speech Sequence Entry");
+			Reference.Index = EntryIndex;
+			Reference.ParticipantName = Entries[EntryIndex].Speaker;
+			Reference.bParticipantRequired = true;
+		}
+	}
+
+	return NodeSnapshot;
+}
+
+void FDlgValidationSnapshot::AddConditions(const TCHAR* Kind, const TArray<FDlgCondition>& Conditions, FDlgValidationNodeSnapshot& OutNode)
+{
+	for (int32 Index = 0; Index < Conditions.Num(); Index++)
+	{
+		const FDlgCondition& Condition = Conditions[Index];
+		FDlgValidationReferenceSnapshot& Reference = OutNode.References.AddDefaulted_GetRef();
+		Reference.Kind = Kind;
+		Reference.Index = Index;
+		Reference.ParticipantName = Condition.ParticipantName;
+		Reference.bParticipantRequired = Condition.IsParticipantInvolved() && Condition.ConditionType != EDlgConditionType::Custom;
+		Reference.bCustomObjectMissing = Condition.ConditionType == EDlgConditionType::Custom && Condition.CustomCondition == nullptr;
+		if (FDlgCondition::HasNodeIndex(Condition.ConditionType))
+		{
+			Reference.ReferencedNodeIndex = Condition.IntValue;
+		}
+	}
+}
+
+void FDlgValidationSnapshot::AddEvents(const TCHAR* Kind, const TArray<FDlgEvent>& Events, FDlgValidationNodeSnapshot& OutNode)
+{
+	for (int32 Index = 0; Index < Events.Num(); Index++)
+	{
+		const FDlgEvent& Event = Events[Index];
+		FDlgValidationReferenceSnapshot& Reference = OutNode.References.AddDefaulted_GetRef();
+		Reference.Kind = Kind;
+		Reference.Index = Index;
+		Reference.ParticipantName = Event.ParticipantName;
+		// Without a participant the event is sent to the node owner, see UDlgNode::FireNodeEnterEvents
+		Reference.bParticipantRequired = false;
+		Reference.bCustomObjectMissing = Event.EventType == EDlgEventType::Custom && Event.CustomEvent == nullptr;
+	}
+}
+
+void FDlgValidationSnapshot::AddTextArguments(const TCHAR* Kind, const TArray<FDlgTextArgument>& TextArguments, FDlgValidationNodeSnapshot& OutNode)
+{
+	for (int32 Index = 0; Index < TextArguments.Num(); Index++)
+	{
+		const FDlgTextArgument& TextArgument = TextArguments[Index];
+		FDlgValidationReferenceSnapshot& Reference = OutNode.References.AddDefaulted_GetRef();
+		Reference.Kind = Kind;
+		Reference.Index = Index;
+		Reference.ParticipantName = TextArgument.ParticipantName;
+		// Without a participant the node owner is used, see FDlgTextArgument::ConstructFormatArgumentValue
+		Reference.bParticipantRequired = false;
+		Reference.bCustomObjectMissing = TextArgument.Type == EDlgTextArgumentType::Custom && TextArgument.CustomTextArgument == nullptr;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgDialogueValidator
+FDlgValidationResult FDlgDialogueValidator::Validate(const FDlgValidationSnapshot& Snapshot)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	FDlgValidationResult Result;
+	Result.DialoguePath = Snapshot.DialoguePath;
+
+	if (!Snapshot.DialogueGUID.IsValid())
+	{
+		Result.Errors.Add(TEXT("The Dialogue does not have a valid GUID"));
+	}
+
+	for (const FDlgValidationNodeSnapshot& StartNode : Snapshot.StartNodes)
+	{
+		ValidateNode(Snapshot, INDEX_NONE, StartNode, Result);
+	}
+
+	// Key: Node GUID, Value: the first node with it
+	TMap<FGuid, int32> NodeIndicesByGUID;
+	NodeIndicesByGUID.Reserve(Snapshot.Nodes.Num());
+	for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); NodeIndex++)
+	{
+		const FDlgValidationNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+		ValidateNode(Snapshot, NodeIndex, Node, Result);
+
+		if (!Node.GUID.IsValid())
+		{
+			Result.Errors.Add(FString::Printf(TEXT("Node %d does not have a valid GUID"), NodeIndex));
+		}
+		else if (const int32* OtherNodeIndex = NodeIndicesByGUID.Find(Node.GUID))
+		{
+			Result.Errors.Add(FString::Printf(TEXT("Node %d has the same GUID = `%s` as Node %d"), NodeIndex, *Node.GUID.ToString(), *OtherNodeIndex));
+		}
+		else
+		{
+			NodeIndicesByGUID.Add(Node.GUID, NodeIndex);
+		}
+	}
+
+	ValidateReachability(Snapshot, Result);
+
+	Result.ValidationMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	return Result;
+}
+
+TArray<FDlgValidationResult> FDlgDialogueValidator::ValidateParallel(const TArray<FDlgValidationSnapshot>& Snapshots)
+{
+	TArray<FDlgValidationResult> Results;
+	Results.SetNum(Snapshots.Num());
+	ParallelFor(Snapshots.Num(), [&Snapshots, &Results](int32 Index)
+	{
+		Results[Index] = Validate(Snapshots[Index]);
+	});
+
+	// The GUIDs of the Dialogues must be unique across all of them
+	TMap<FGuid, int32> SnapshotIndicesByGUID;
+	SnapshotIndicesByGUID.Reserve(Snapshots.Num());
+	for (int32 Index = 0; Index < Snapshots.Num(); Index++)
+	{
+		const FGuid& GUID = Snapshots[Index].DialogueGUID;
+		if (!GUID.IsValid())
+		{
+			continue;
+		}
+
+		if (const int32* OtherIndex = SnapshotIndicesByGUID.Find(GUID))
+		{
+			Results[Index].Errors.Add(FString::Printf(
+				TEXT("The Dialogue has the same GUID = `%s` as the Dialogue = `%s`"), *GUID.ToString(), *Snapshots[*OtherIndex].DialoguePath
+			));
+		}
+		else
+		{
+			SnapshotIndicesByGUID.Add(GUID, Index);
+		}
+	}
+
+	return Results;
+}
+
+void FDlgDialogueValidator::ValidateNode(
+	const FDlgValidationSnapshot& Snapshot,
+	int32 NodeIndex,
+	const FDlgValidationNodeSnapshot& Node,
+	FDlgValidationResult& OutResult
+)
+{
+	const FString NodeContext = NodeIndex == INDEX_NONE ? FString(TEXT("Start Node")) : FString::Printf(TEXT("Node %d"), NodeIndex);
+	if (Node.NodeType.IsEmpty())
+	{
+		OutResult.Errors.Add(FString::Printf(TEXT("%s is null"), *NodeContext));
+		return;
+	}
+
+	if (Node.bParticipantRequired && Node.ParticipantName.IsNone())
+	{
+		OutResult.Errors.Add(FString::Printf(TEXT("%s (%s) does not have a participant"), *NodeContext, *Node.NodeType));
+	}
+
+	for (const int32 TargetIndex : Node.TargetIndices)
+	{
+		if (!Snapshot.Nodes.IsValidIndex(TargetIndex))
+		{
+			OutResult.Errors.Add(FString::Printf(TEXT("%s (%s) points to the Node %d that does not exist"), *NodeContext, *Node.NodeType, TargetIndex));
+		}
+	}
+
+	for (const FDlgValidationReferenceSnapshot& Reference : Node.References)
+	{
+		if (Reference.bParticipantRequired && Reference.ParticipantName.IsNone())
+		{
+			OutResult.Errors.Add(FString::Printf(TEXT("%s %s %d does not have a participant"), *NodeContext, Reference.Kind, Reference.Index));
+		}
+		if (Reference.bCustomObjectMissing)
+		{
+			OutResult.Errors.Add(FString::Printf(TEXT("%s %s %d is custom but does not have an object, is its class missing?"), *NodeContext, Reference.Kind, Reference.Index));
+		}
+		if (Reference.ReferencedNodeIndex != INDEX_NONE && !Snapshot.Nodes.IsValidIndex(Reference.ReferencedNodeIndex))
+		{
+			OutResult.Errors.Add(FString::Printf(
+				TEXT("%s %s %d points to the Node %d that does not exist"), *NodeContext, Reference.Kind, Reference.Index, Reference.ReferencedNodeIndex
+			));
+		}
+	}
+}
+
+void FDlgDialogueValidator::ValidateReachability(const FDlgValidationSnapshot& Snapshot, FDlgValidationResult& OutResult)
+{
+	TBitArray<> Reached(false, Snapshot.Nodes.Num());
+	TArray<int32> Stack;
+	auto AddTargets = [&Snapshot, &Reached, &Stack](const FDlgValidationNodeSnapshot& Node)
+	{
+		for (const int32 TargetIndex : Node.TargetIndices)
+		{
+			if (Snapshot.Nodes.IsValidIndex(TargetIndex) && !Reached[TargetIndex])
+			{
+				Reached[TargetIndex] = true;
+				Stack.Add(TargetIndex);
+			}
+		}
+	};
+
+	for (const FDlgValidationNodeSnapshot& StartNode : Snapshot.StartNodes)
+	{
+		AddTargets(StartNode);
+	}
+	while (Stack.Num() > 0)
+	{
+		AddTargets(Snapshot.Nodes[Stack.Pop()]);
+	}
+
+	for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); NodeIndex++)
+	{
+		if (!Reached[NodeIndex])
+		{
+			OutResult.Warnings.Add(FString::Printf(TEXT("Node %d (%s) can not be reached from any Start Node"), NodeIndex, *Snapshot.Nodes[NodeIndex].NodeType));
+		}
+	}
+}
@@ -0,0 +1,121 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "DlgDialogueValidator.generated.h"
+
+class UDlgDialogue;
+class UDlgNode;
+struct FDlgCondition;
+struct FDlgEvent;
+struct FDlgTextArgument;
+
+// Something a node uses that names a participant, a custom object or another node (conditions, events, text arguments)
+struct DLGSYSTEM_API FDlgValidationReferenceSnapshot
+{
+public:
+	// Static description used in the messages, e.g. "Enter Condition"
+	const TCHAR* Kind = TEXT("");
+	int32 Index = INDEX_NONE;
+
+	FName ParticipantName;
+	bool bParticipantRequired = false;
+
+	// Custom type without the custom object (or its class was not found on load)
+	bool bCustomObjectMissing = false;
+
+	// INDEX_NONE if it does not reference a node
+	int32 ReferencedNodeIndex = INDEX_NONE;
+};
+
+// Read-only copy of a node, see FDlgValidationSnapshot
+struct DLGSYSTEM_API FDlgValidationNodeSnapshot
+{
+public:
+	FGuid GUID;
+	FString NodeType;
+
+	// The participant of the node, only required by the speech nodes
+	FName ParticipantName;
+	bool bParticipantRequired = false;
+
+	// Edges and proxy targets
+	TArray<int32> TargetIndices;
+
+	TArray<FDlgValidationReferenceSnapshot> References;
+};
+
+// Read-only copy of everything FDlgDialogueValidator checks, gathered on the game thread so the validation can run on any thread
+struct DLGSYSTEM_API FDlgValidationSnapshot
+{
+public:
+	// Must be called on the game thread
+	static FDlgValidationSnapshot Create(const UDlgDialogue& Dialogue);
+
+public:
+	FString DialoguePath;
+	FGuid DialogueGUID;
+
+	// Index INDEX_NONE is used for the start nodes in the messages
+	TArray<FDlgValidationNodeSnapshot> StartNodes;
+	TArray<FDlgValidationNodeSnapshot> Nodes;
+
+protected:
+	static FDlgValidationNodeSnapshot CreateNode(const UDlgNode& Node);
+	static void AddConditions(const TCHAR* Kind, const TArray<FDlgCondition>& Conditions, FDlgValidationNodeSnapshot& OutNode);
+	static void AddEvents(const TCHAR* Kind, const TArray<FDlgEvent>& Events, FDlgValidationNodeSnapshot& OutNode);
+	static void AddTextArguments(const TCHAR* Kind, const TArray<FDlgTextArgument>& TextArguments, FDlgValidationNodeSnapshot& OutNode);
+};
+
+
+USTRUCT()
+struct DLGSYSTEM_API FDlgValidationResult
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	bool IsValid() const { return Errors.Num() == 0; }
+
+public:
+	UPROPERTY()
+	FString DialoguePath;
+
+	UPROPERTY()
+	TArray<FString> Errors;
+
+	// Unreachable nodes
+	UPROPERTY()
+	TArray<FString> Warnings;
+
+	UPROPERTY()
+	double ValidationMs = 0.0;
+};
+
+
+/**
+ * Checks the Dialogues for:
+ * - invalid or duplicate GUIDs (of the nodes, and of the Dialogues themselves with ValidateParallel)
+ * - edges, proxies and conditions that point to a node that does not exist
+ * - nodes that can not be reached from any start node
+ * - conditions and speech nodes without a participant name (the events and text arguments fall back to the node owner)
+ * - custom conditions, events and text arguments without an object (e.g. the class was deleted)
+ *
+ * The checks only read the FDlgValidationSnapshot, so they can run in parallel on the worker threads.
+ */
+class DLGSYSTEM_API FDlgDialogueValidator
+{
+public:
+	// Validates a single snapshot, thread safe
+	static FDlgValidationResult Validate(const FDlgValidationSnapshot& Snapshot);
+
+	// Validates all the snapshots on the worker threads, also checks if the Dialogue GUIDs are unique
+	static TArray<FDlgValidationResult> ValidateParallel(const TArray<FDlgValidationSnapshot>& Snapshots);
+
+	// Creates the snapshot and validates it on the calling (game) thread
+	static FDlgValidationResult Validate(const UDlgDialogue& Dialogue) { return Validate(FDlgValidationSnapshot::Create(Dialogue)); }
+
+protected:
+	static void ValidateNode(const FDlgValidationSnapshot& Snapshot, int32 NodeIndex, const FDlgValidationNodeSnapshot& Node, FDlgValidationResult& OutResult);
+	static void ValidateReachability(const FDlgValidationSnapshot& Snapshot, FDlgValidationResult& OutResult);
+};
@@ -4,6 +4,9 @@
 #include "DlgConstants.h"
 #include "DlgContext.h"
 #include "DlgLocalizationHelper.h"
+#include "DlgRuntimeStats.h"
+#include "DlgParticipantCaller.h"
+#include "Logging/DlgLogger.h"
 #include "Nodes/DlgNode_Selector.h"
 #include "Nodes/DlgNode_Speech.h"
 
@@ -27,6 +30,32 @@ bool FDlgEdge::IsTextVisible(const UDlgNode& ParentNode)
 	return true;
 }
 
+bool FDlgEdge::IsWeightVisible(const UDlgNode& ParentNode)
+{
+	const UDlgNode_Selector* Node = Cast<UDlgNode_Selector>(&ParentNode);
+	return Node && Node->GetSelectorType() == EDlgNodeSelectorType::WeightedRandom;
+}
+
+float FDlgEdge::GetWeight(const UDlgContext& Context) const
+{
+	if (WeightParticipantName.IsNone() || WeightFloatName.IsNone())
+	{
+		return FMath::Max(Weight, 0.f);
+	}
+
+	const UObject* Participant = Context.GetParticipant(WeightParticipantName);
+	if (!Participant)
+	{
+		FDlgLogger::Get().Warningf(
+			TEXT("GetWeight - Participant = `%s` is not in the Dialogue, using the Weight = %f without the value `%s`.\nContext:\n\t%s"),
+			*WeightParticipantName.ToString(), Weight, *WeightFloatName.ToString(), *Context.GetContextString()
+		);
+		return FMath::Max(Weight, 0.f);
+	}
+
+	return FMath::Max(Weight * FDlgParticipantCaller::GetFloatValue(Participant, WeightFloatName), 0.f);
+}
+
 void FDlgEdge::UpdateTextValueFromDefaultAndRemapping(
 	const UDlgDialogue& ParentDialogue,
 	const UDlgNode& ParentNode,
@@ -81,7 +110,14 @@ void FDlgEdge::UpdateTextsNamespacesAndKeys(const UObject* ParentObject, const U
 	FDlgLocalizationHelper::UpdateTextNamespaceAndKey(ParentObject, Settings, Text);
 }
 
-bool FDlgEdge::Evaluate(const UDlgContext& Context, TSet<const UDlgNode*> AlreadyVisitedNodes) const
+void FDlgEdge::CompactRuntimeData(TMap<FString, FText>& SharedTexts)
+{
+	Conditions.Shrink();
+	TextArguments.Shrink();
+	FDlgLocalizationHelper::ShareText(Text, SharedTexts);
+}
+
+bool FDlgEdge::Evaluate(const UDlgContext& Context) const
 {
 	if (!IsValid())
 	{
@@ -89,7 +125,7 @@ bool FDlgEdge::Evaluate(const UDlgContext& Context, TSet<const UDlgNode*> Alread
 	}
 
 	// Check target node enter conditions
-	if (!Context.IsNodeEnterable(TargetIndex, AlreadyVisitedNodes))
+	if (!Context.IsNodeEnterable(TargetIndex))
 	{
 		return false;
 	}
@@ -105,6 +141,7 @@ void FDlgEdge::RebuildConstructedText(const UDlgContext& Context, FName Fallback
 		return;
 	}
 
+	FDlgScopedRuntimeTimer ScopedTimer(FDlgRuntimeStats::Get().GetTextFormatStats());
 	FFormatNamedArguments OrderedArguments;
 	for (const FDlgTextArgument& DlgArgument : TextArguments)
 	{
@@ -37,6 +37,9 @@ public:
 			SpeakerState == Other.SpeakerState &&
 			Text.EqualTo(Other.Text) &&
 			bIncludeInAllOptionListIfUnsatisfied == Other.bIncludeInAllOptionListIfUnsatisfied &&
+			Weight == Other.Weight &&
+			WeightParticipantName == Other.WeightParticipantName &&
+			WeightFloatName == Other.WeightFloatName &&
 			TextArguments == Other.TextArguments &&
 			Conditions == Other.Conditions;
 	}
@@ -61,12 +64,23 @@ public:
 	// Updates the namespace or keys depending on the settings
 	void UpdateTextsNamespacesAndKeys(const UObject* ParentObject, const UDlgSystemSettings& Settings);
 
+	// Shrinks the arrays and shares the text with the identical ones, see UDlgDialogue::CompactRuntimeData
+	void CompactRuntimeData(TMap<FString, FText>& SharedTexts);
+
 	// Rebuilds TextArguments
 	void RebuildTextArguments() { FDlgTextArgument::UpdateTextArgumentArray(Text, TextArguments); }
 	void RebuildTextArgumentsFromPreview(const FText& Preview) { FDlgTextArgument::UpdateTextArgumentArray(Preview, TextArguments); }
 
 	// Returns with true if every condition attached to the edge and every enter condition of the target node are satisfied //
-	bool Evaluate(const UDlgContext& Context, TSet<const UDlgNode*> AlreadyVisitedNodes) const;
+	// Continues the evaluation path in progress, if any, see FDlgEvaluationPathScope
+	bool Evaluate(const UDlgContext& Context) const;
+
+	// The chance of this edge to be picked by the weighted random selector node, relative to the other satisfied edges
+	// Weight, multiplied by the float value WeightFloatName of WeightParticipantName if set. Never negative.
+	float GetWeight(const UDlgContext& Context) const;
+
+	// Is the weight of this edge used? Only the edges of the weighted random selector nodes have one
+	static bool IsWeightVisible(const UDlgNode& ParentNode);
 
 	// Constructs the ConstructedText.
 	void RebuildConstructedText(const UDlgContext& Context, FName FallbackParticipantName);
@@ -135,6 +149,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Instanced, Category = "DialogueEdge")
 	UDlgNodeData* EdgeData = nullptr;
 
+	// Relative chance of this edge in a weighted random selector node, zero weighted edges are never picked
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DialogueEdge", Meta = (ClampMin = 0))
+	float Weight = 1.f;
+
+	// Optional, the Weight is multiplied by the float value WeightFloatName of this participant
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DialogueEdge")
+	FName WeightParticipantName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DialogueEdge")
+	FName WeightFloatName;
+
 protected:
 	// Some Variables are here to stop misuse
 
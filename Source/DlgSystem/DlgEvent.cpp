@@ -4,12 +4,17 @@
 #include "DlgConstants.h"
 #include "DlgContext.h"
 #include "NYReflectionHelper.h"
-#include "DlgDialogueParticipant.h"
+#include "DlgParticipantCaller.h"
 #include "DlgHelper.h"
+#include "DlgTrace.h"
 #include "Logging/DlgLogger.h"
 
 void FDlgEvent::Call(UDlgContext& Context, const FString& ContextString, UObject* Participant) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_DlgEvent);
+	INC_DWORD_STAT(STAT_DlgNumEvents);
+	DLG_TRACE_SCOPE(TEXT("Event"), EventTypeToString(EventType), Context);
+
 	const bool bHasParticipant = ValidateIsParticipantValid(
 		Context,
 		FString::Printf(TEXT("%s::Call"), *ContextString),
@@ -40,19 +45,19 @@ void FDlgEvent::Call(UDlgContext& Context, const FString& ContextString, UObject
 	switch (EventType)
 	{
 		case EDlgEventType::Event:
-			IDlgDialogueParticipant::Execute_OnDialogueEvent(Participant, &Context, EventName);
+			FDlgParticipantCaller::OnDialogueEvent(Participant, &Context, EventName);
 			break;
 		case EDlgEventType::ModifyInt:
-			IDlgDialogueParticipant::Execute_ModifyIntValue(Participant, EventName, bDelta, IntValue);
+			FDlgParticipantCaller::ModifyIntValue(Participant, EventName, bDelta, IntValue);
 			break;
 		case EDlgEventType::ModifyFloat:
-			IDlgDialogueParticipant::Execute_ModifyFloatValue(Participant, EventName, bDelta, FloatValue);
+			FDlgParticipantCaller::ModifyFloatValue(Participant, EventName, bDelta, FloatValue);
 			break;
 		case EDlgEventType::ModifyBool:
-			IDlgDialogueParticipant::Execute_ModifyBoolValue(Participant, EventName, bValue);
+			FDlgParticipantCaller::ModifyBoolValue(Participant, EventName, bValue);
 			break;
 		case EDlgEventType::ModifyName:
-			IDlgDialogueParticipant::Execute_ModifyNameValue(Participant, EventName, NameValue);
+			FDlgParticipantCaller::ModifyNameValue(Participant, EventName, NameValue);
 			break;
 
 		case EDlgEventType::ModifyClassIntVariable:
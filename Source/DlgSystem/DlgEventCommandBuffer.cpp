@@ -0,0 +1,86 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgEventCommandBuffer.h"
+
+#include "DlgContext.h"
+
+bool FDlgEventCommandBuffer::CanMergeIntoLastCommand(const FDlgEvent& Event, const UObject* Participant) const
+{
+	// Any event in between might read or modify the values, only the adjacent modifications are merged
+	if (Commands.Num() == 0 || !IsValueModification(Event.EventType))
+	{
+		return false;
+	}
+
+	const FCommand& LastCommand = Commands.Last();
+	return LastCommand.Participant == Participant
+		&& LastCommand.Event.EventType == Event.EventType
+		&& LastCommand.Event.EventName == Event.EventName;
+}
+
+void FDlgEventCommandBuffer::Add(const FDlgEvent& Event, UObject* Participant)
+{
+	if (CanMergeIntoLastCommand(Event, Participant))
+	{
+		FDlgEvent& MergedEvent = Commands.Last().Event;
+		switch (Event.EventType)
+		{
+			case EDlgEventType::ModifyInt:
+			case EDlgEventType::ModifyClassIntVariable:
+				// A set followed by deltas stays a set
+				MergedEvent.IntValue = Event.bDelta ? MergedEvent.IntValue + Event.IntValue : Event.IntValue;
+				MergedEvent.bDelta = MergedEvent.bDelta && Event.bDelta;
+				break;
+
+			case EDlgEventType::ModifyFloat:
+			case EDlgEventType::ModifyClassFloatVariable:
+				MergedEvent.FloatValue = Event.bDelta ? MergedEvent.FloatValue + Event.FloatValue : Event.FloatValue;
+				MergedEvent.bDelta = MergedEvent.bDelta && Event.bDelta;
+				break;
+
+			default:
+				// Bool and Name values, the last one wins
+				MergedEvent.bValue = Event.bValue;
+				MergedEvent.NameValue = Event.NameValue;
+				break;
+		}
+
+		NumCoalescedEvents++;
+		return;
+	}
+
+	Commands.Add({ Event, Participant });
+}
+
+void FDlgEventCommandBuffer::Apply(UDlgContext& Context, const FString& ContextString)
+{
+	// The events can enter other nodes which fill the buffer again, call the commands from a local array
+	TArray<FCommand> AppliedCommands = MoveTemp(Commands);
+	Commands.Reset();
+
+	TArray<UObject*, TInlineAllocator<4>> ModifiedParticipants;
+	for (const FCommand& Command : AppliedCommands)
+	{
+		Command.Event.Call(Context, ContextString, Command.Participant);
+		if (IsValueModification(Command.Event.EventType) && IsValid(Command.Participant))
+		{
+			ModifiedParticipants.AddUnique(Command.Participant);
+		}
+	}
+
+	for (UObject* Participant : ModifiedParticipants)
+	{
+		Context.OnParticipantValuesChanged.Broadcast(&Context, Participant);
+	}
+
+	// Keep the memory for the next node
+	if (Commands.Num() == 0)
+	{
+		AppliedCommands.Reset();
+		Commands = MoveTemp(AppliedCommands);
+	}
+}
+
+void FDlgEventCommandBuffer::Reset()
+{
+	Commands.Reset();
+}
@@ -0,0 +1,52 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DlgEvent.h"
+
+class UDlgContext;
+
+/**
+ * Collects the enter events of a node when UDlgSystemSettings::bDeferNodeEnterEvents is enabled and calls them in one pass.
+ * Consecutive modifications of the same value of a participant are coalesced into a single call. Only adjacent events are
+ * merged, so the order of the calls and the values seen by the participants are the same as without the buffer.
+ */
+class DLGSYSTEM_API FDlgEventCommandBuffer
+{
+public:
+	// Adds the Event, merges it into the previous event if that modified the same value
+	void Add(const FDlgEvent& Event, UObject* Participant);
+
+	// Calls the collected events in order, then broadcasts UDlgContext::OnParticipantValuesChanged once for each participant
+	// that had any of its values modified. The buffer is empty afterwards.
+	void Apply(UDlgContext& Context, const FString& ContextString);
+
+	void Reset();
+
+	bool IsEmpty() const { return Commands.Num() == 0; }
+	int32 Num() const { return Commands.Num(); }
+
+	// Number of events merged into a previous one since the creation of the buffer
+	int32 GetNumCoalescedEvents() const { return NumCoalescedEvents; }
+
+	// Does this event only modify a value that can be merged with the other modifications of the same value?
+	static bool IsValueModification(EDlgEventType Type)
+	{
+		return FDlgEvent::HasDialogueValue(Type) || FDlgEvent::HasClassVariable(Type);
+	}
+
+protected:
+	struct FCommand
+	{
+		FDlgEvent Event;
+		UObject* Participant = nullptr;
+	};
+
+	// Can Event be merged into the last command? It has to modify the same value of the same participant.
+	bool CanMergeIntoLastCommand(const FDlgEvent& Event, const UObject* Participant) const;
+
+	// The commands in the order of their events
+	TArray<FCommand> Commands;
+
+	int32 NumCoalescedEvents = 0;
+};
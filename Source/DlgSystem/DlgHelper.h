@@ -217,6 +217,38 @@ public:
 	FORCEINLINE static bool IsFloatEqual(const float A, const float B) { return FMath::IsNearlyEqual(A, B, KINDA_SMALL_NUMBER); }
 	FORCEINLINE static bool IsPathInProjectDirectory(const FString& Path) { return Path.StartsWith("/Game");  }
 
+	// Moves the asset of the HardReference into the SoftReference (or back)
+	template <typename AssetType>
+	static void ConvertAssetReference(AssetType*& HardReference, TSoftObjectPtr<AssetType>& SoftReference, bool bToSoftReference)
+	{
+		if (bToSoftReference)
+		{
+			if (HardReference)
+			{
+				SoftReference = HardReference;
+				HardReference = nullptr;
+			}
+		}
+		else if (!SoftReference.IsNull())
+		{
+			if (!HardReference)
+			{
+				HardReference = SoftReference.LoadSynchronous();
+			}
+			SoftReference.Reset();
+		}
+	}
+
+	// Adds the path of the SoftReference if it is set
+	template <typename AssetType>
+	static void AddSoftAssetPath(const TSoftObjectPtr<AssetType>& SoftReference, TArray<FSoftObjectPath>& OutAssetPaths)
+	{
+		if (!SoftReference.IsNull())
+		{
+			OutAssetPaths.Add(SoftReference.ToSoftObjectPath());
+		}
+	}
+
 	static FString GetFullNameFromObject(const UObject* Object)
 	{
 		if (!IsValid(Object))
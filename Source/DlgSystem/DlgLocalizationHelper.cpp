@@ -5,6 +5,9 @@
 #include "Internationalization/Text.h"
 #include "Internationalization/TextPackageNamespaceUtil.h"
 #include "Serialization/TextReferenceCollector.h"
+#include "Internationalization/StringTable.h"
+#include "Internationalization/StringTableCore.h"
+#include "Misc/Crc.h"
 
 
 bool FDlgLocalizationHelper::WillTextNamespaceBeUpdated(const FText& Text)
@@ -20,6 +23,33 @@ bool FDlgLocalizationHelper::WillTextNamespaceBeUpdated(const FText& Text, const
 		   Settings.IsIgnoredTextForLocalization(Text);
 }
 
+void FDlgLocalizationHelper::ShareText(FText& Text, TMap<FString, FText>& SharedTexts)
+{
+	if (Text.IsEmpty())
+	{
+		Text = FText::GetEmpty();
+		return;
+	}
+
+	static const FString DefaultValue = TEXT("");
+	const FString* SourceString = FTextInspector::GetSourceString(Text);
+	const FString TextId = FString::Printf(
+		TEXT("%s|%s|%s"),
+		*FTextInspector::GetNamespace(Text).Get(DefaultValue),
+		*FTextInspector::GetKey(Text).Get(DefaultValue),
+		SourceString ? **SourceString : TEXT("")
+	);
+
+	if (const FText* SharedText = SharedTexts.Find(TextId))
+	{
+		Text = *SharedText;
+	}
+	else
+	{
+		SharedTexts.Add(TextId, Text);
+	}
+}
+
 void FDlgLocalizationHelper::UpdateTextFromRemapping(const UDlgSystemSettings& Settings, FText& OutText)
 {
 	if (Settings.IsTextRemapped(OutText))
@@ -59,6 +89,42 @@ void FDlgLocalizationHelper::UpdateTextNamespaceAndKey(const UObject* Object, co
 	Text = FText::ChangeKey(NewNamespace, NewKey, Text);
 }
 
+bool FDlgLocalizationHelper::InternTextIntoStringTable(UStringTable& StringTable, FText& Text)
+{
+	static const FString DefaultValue = TEXT("");
+	if (Text.IsEmpty() || Text.IsFromStringTable() || Text.IsCultureInvariant())
+	{
+		return false;
+	}
+
+	// The namespace is part of the key, so the identical source strings that need different translations can be kept apart
+	const FString SourceString = *FTextInspector::GetSourceString(Text);
+	const FString Namespace = TextNamespaceUtil::StripPackageNamespace(FTextInspector::GetNamespace(Text).Get(DefaultValue));
+	const FString BaseKey = FString::Printf(TEXT("%s_%08X"), *Namespace, FCrc::StrCrc32(*SourceString));
+
+	// Resolve the hash collisions by adding a suffix
+	FStringTableRef MutableStringTable = StringTable.GetMutableStringTable();
+	FString Key = BaseKey;
+	FString ExistingSourceString;
+	for (int32 Suffix = 1; MutableStringTable->GetSourceString(Key, ExistingSourceString); Suffix++)
+	{
+		if (ExistingSourceString.Equals(SourceString, ESearchCase::CaseSensitive))
+		{
+			break;
+		}
+		Key = FString::Printf(TEXT("%s_%d"), *BaseKey, Suffix);
+	}
+
+	if (!MutableStringTable->GetSourceString(Key, ExistingSourceString))
+	{
+		StringTable.Modify();
+		MutableStringTable->SetSourceString(Key, SourceString);
+	}
+
+	Text = FText::FromStringTable(StringTable.GetStringTableId(), Key);
+	return true;
+}
+
 bool FDlgLocalizationHelper::GetNewNamespaceAndKey(
 	const UObject* Object,
 	const UDlgSystemSettings& Settings,
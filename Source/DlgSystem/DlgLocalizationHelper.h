@@ -8,6 +8,7 @@
 #endif// WITH_EDITOR && USE_STABLE_LOCALIZATION_KEYS
 
 class UDlgSystemSettings;
+class UStringTable;
 
 /**
  * General helper methods
@@ -22,15 +23,26 @@ public:
 	// Updates the text namespace to match the settings options
 	// NOTE: only works in editor mode
 	static void UpdateTextNamespaceAndKey(const UObject* Object, const UDlgSystemSettings& Settings, FText& Text);
+
+	// Replaces the Text with the entry of the StringTable keyed by its namespace and the hash of its source string, adds the entry if it is missing
+	// NOTE: the StringTable is only modified in memory, the caller must save it together with the Dialogues, see UDlgInternEdgeTextsCommandlet
+	// NOTE: only works in editor mode
+	// Return true if the Text was replaced
+	static bool InternTextIntoStringTable(UStringTable& StringTable, FText& Text);
 #else
 	// NO OP
 	static void UpdateTextNamespaceAndKey(const UObject* Object, const UDlgSystemSettings& Settings, FText& Text) {}
+	static bool InternTextIntoStringTable(UStringTable& StringTable, FText& Text) { return false; }
 #endif
 
 	// Will we update the text namespace for the following texts
 	static bool WillTextNamespaceBeUpdated(const FText& Text);
 	static bool WillTextNamespaceBeUpdated(const FText& Text, const UDlgSystemSettings& Settings);
 
+	// Makes Text share the data of an identical text (same namespace, key and source string) found in SharedTexts
+	// or adds it there, the empty texts share the global empty text
+	static void ShareText(FText& Text, TMap<FString, FText>& SharedTexts);
+
 #if WITH_EDITOR && USE_STABLE_LOCALIZATION_KEYS
 	// Copied From IEditableTextProperty
 
@@ -13,6 +13,8 @@
 #include "DlgDialogueParticipant.h"
 #include "DlgDialogue.h"
 #include "DlgMemory.h"
+#include "DlgMemorySubsystem.h"
+#include "DlgSchedulerSubsystem.h"
 #include "DlgContext.h"
 #include "Logging/DlgLogger.h"
 #include "DlgHelper.h"
@@ -22,7 +24,7 @@ TWeakObjectPtr<const UObject> UDlgManager::UserWorldContextObjectPtr = nullptr;
 
 bool UDlgManager::bCalledLoadAllDialoguesIntoMemory = false;;
 
-UDlgContext* UDlgManager::StartDialogueWithDefaultParticipants(UObject* WorldContextObject, UDlgDialogue* Dialogue)
+UDlgContext* UDlgManager::StartDialogueWithDefaultParticipants(UObject* WorldContextObject, UDlgDialogue* Dialogue, int32 RandomSeed)
 {
 	if (!IsValid(Dialogue))
 	{
@@ -96,10 +98,10 @@ UDlgContext* UDlgManager::StartDialogueWithDefaultParticipants(UObject* WorldCon
 		return nullptr;
 	}
 
-	return StartDialogueWithContext(TEXT("StartDialogueWithDefaultParticipants"), Dialogue, Participants);
+	return StartDialogueWithContext(TEXT("StartDialogueWithDefaultParticipants"), Dialogue, Participants, RandomSeed);
 }
 
-UDlgContext* UDlgManager::StartDialogueWithContext(const FString& ContextString, UDlgDialogue* Dialogue, const TArray<UObject*>& Participants)
+UDlgContext* UDlgManager::StartDialogueWithContext(const FString& ContextString, UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, int32 RandomSeed)
 {
 	const FString ContextMessage = ContextString.IsEmpty()
 		? FString::Printf(TEXT("StartDialogue"))
@@ -112,6 +114,10 @@ UDlgContext* UDlgManager::StartDialogueWithContext(const FString& ContextString,
 	}
 
 	auto* Context = NewObject<UDlgContext>(Participants[0], UDlgContext::StaticClass());
+	if (RandomSeed != 0)
+	{
+		Context->SetRandomSeed(RandomSeed);
+	}
 	if (Context->StartWithContext(ContextMessage, Dialogue, ParticipantBinding))
 	{
 		return Context;
@@ -183,31 +189,47 @@ UDlgContext* UDlgManager::ResumeDialogueFromNodeGUID(
 	return nullptr;
 }
 
-UDlgContext* UDlgManager::StartMonologue(UDlgDialogue* Dialogue, UObject* Participant)
+UDlgContext* UDlgManager::StartMonologue(UDlgDialogue* Dialogue, UObject* Participant, int32 RandomSeed)
 {
 	TArray<UObject*> Participants;
 	Participants.Add(Participant);
-	return StartDialogueWithContext(TEXT("StartMonologue"), Dialogue, Participants);
+	return StartDialogueWithContext(TEXT("StartMonologue"), Dialogue, Participants, RandomSeed);
 }
 
-UDlgContext* UDlgManager::StartDialogue2(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1)
+bool UDlgManager::EvaluateBark(UDlgDialogue* Dialogue, UObject* Participant, FDlgBarkResult& OutResult, bool bRecordHistory, int32 RandomSeed)
+{
+	check(IsInGameThread());
+
+	// Reused by all the barks of the game instance
+	UDlgSchedulerSubsystem* Scheduler = UDlgSchedulerSubsystem::Get(Participant);
+	UDlgContext* BarkContext = Scheduler ? Scheduler->GetBarkContext() : nullptr;
+
+	// No game instance (e.g. editor utilities) or a bark fired by the enter events of another bark, use a transient context
+	UDlgContext* Context = BarkContext && !BarkContext->IsEvaluatingBark() ? BarkContext : NewObject<UDlgContext>(GetTransientPackage());
+
+	// 0 keeps the random seed, do not continue the seeded sequence of a previous bark of the shared context
+	Context->SetRandomSeed(RandomSeed != 0 ? RandomSeed : FMath::Rand());
+	return Context->EvaluateBark(Dialogue, Participant, bRecordHistory, OutResult);
+}
+
+UDlgContext* UDlgManager::StartDialogue2(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1, int32 RandomSeed)
 {
 	TArray<UObject*> Participants;
 	Participants.Add(Participant0);
 	Participants.Add(Participant1);
-	return StartDialogueWithContext(TEXT("StartDialogue2"), Dialogue, Participants);
+	return StartDialogueWithContext(TEXT("StartDialogue2"), Dialogue, Participants, RandomSeed);
 }
 
-UDlgContext* UDlgManager::StartDialogue3(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1, UObject* Participant2)
+UDlgContext* UDlgManager::StartDialogue3(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1, UObject* Participant2, int32 RandomSeed)
 {
 	TArray<UObject*> Participants;
 	Participants.Add(Participant0);
 	Participants.Add(Participant1);
 	Participants.Add(Participant2);
-	return StartDialogueWithContext(TEXT("StartDialogue3"), Dialogue, Participants);
+	return StartDialogueWithContext(TEXT("StartDialogue3"), Dialogue, Participants, RandomSeed);
 }
 
-UDlgContext* UDlgManager::StartDialogue4(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1, UObject* Participant2, UObject* Participant3)
+UDlgContext* UDlgManager::StartDialogue4(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1, UObject* Participant2, UObject* Participant3, int32 RandomSeed)
 {
 	TArray<UObject*> Participants;
 	Participants.Add(Participant0);
@@ -215,7 +237,7 @@ UDlgContext* UDlgManager::StartDialogue4(UDlgDialogue* Dialogue, UObject* Partic
 	Participants.Add(Participant2);
 	Participants.Add(Participant3);
 
-	return StartDialogueWithContext(TEXT("StartDialogue4"), Dialogue, Participants);
+	return StartDialogueWithContext(TEXT("StartDialogue4"), Dialogue, Participants, RandomSeed);
 }
 
 int32 UDlgManager::LoadAllDialoguesIntoMemory(bool bAsync)
@@ -391,9 +413,9 @@ TMap<FGuid, UDlgDialogue*> UDlgManager::GetAllDialoguesGUIDsMap()
 	return DialoguesMap;
 }
 
-const TMap<FGuid, FDlgHistory>& UDlgManager::GetDialogueHistory()
+TMap<FGuid, FDlgHistory> UDlgManager::GetDialogueHistory()
 {
-	return FDlgMemory::Get().GetHistoryMaps();
+	return FDlgMemory::Get().GetHistoryMapsCopy();
 }
 
 void UDlgManager::SetDialogueHistory(const TMap<FGuid, FDlgHistory>& DlgHistory)
@@ -404,6 +426,15 @@ void UDlgManager::SetDialogueHistory(const TMap<FGuid, FDlgHistory>& DlgHistory)
 void UDlgManager::ClearDialogueHistory()
 {
 	FDlgMemory::Get().Empty();
+
+	// The history of every game instance, if bDialogueHistoryPerGameInstance is enabled
+	for (TObjectIterator<UDlgMemorySubsystem> Itr; Itr; ++Itr)
+	{
+		if (!Itr->HasAnyFlags(RF_ClassDefaultObject))
+		{
+			Itr->ClearDialogueHistory();
+		}
+	}
 }
 
 bool UDlgManager::DoesObjectImplementDialogueParticipantInterface(const UObject* Object)
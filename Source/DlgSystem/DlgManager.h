@@ -5,6 +5,7 @@
 #include "DlgDialogue.h"
 #include "DlgDialogueParticipant.h"
 #include "DlgMemory.h"
+#include "DlgContext.h"
 
 #include "DlgManager.generated.h"
 
@@ -42,13 +43,14 @@ public:
 	 *
 	 *	NOTE: If this fails because it can't find the unique participants you should use the StartDialogue* functions
 	 *
+	 * @param RandomSeed	- Seeds the random selectors of the context, see UDlgContext::SetRandomSeed. 0 keeps the random seed.
 	 * @returns The dialogue context object or nullptr if something went wrong
 	 */
-	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch", meta = (WorldContext = "WorldContextObject"))
-	static UDlgContext* StartDialogueWithDefaultParticipants(UObject* WorldContextObject, UDlgDialogue* Dialogue);
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch", meta = (WorldContext = "WorldContextObject", AdvancedDisplay = "RandomSeed"))
+	static UDlgContext* StartDialogueWithDefaultParticipants(UObject* WorldContextObject, UDlgDialogue* Dialogue, int32 RandomSeed = 0);
 
 	// Supplies where we called this from
-	static UDlgContext* StartDialogueWithContext(const FString& ContextString, UDlgDialogue* Dialogue, const TArray<UObject*>& Participants);
+	static UDlgContext* StartDialogueWithContext(const FString& ContextString, UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, int32 RandomSeed = 0);
 
 	/**
 	 * Starts a Dialogue with the provided Dialogue and Participants array
@@ -57,12 +59,13 @@ public:
 	 *  - Any UObject in the Participant array does not implement the Participant Interface
 	 *  - Participant->GetParticipantName() does not exist in the Dialogue
 	 *
+	 * @param RandomSeed	- Seeds the random selectors of the context, see UDlgContext::SetRandomSeed. 0 keeps the random seed.
 	 * @returns The dialogue context object or nullptr if something wrong happened
 	 */
-	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch")
-	static UDlgContext* StartDialogue(UDlgDialogue* Dialogue, UPARAM(ref)const TArray<UObject*>& Participants)
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch", meta = (AdvancedDisplay = "RandomSeed"))
+	static UDlgContext* StartDialogue(UDlgDialogue* Dialogue, UPARAM(ref)const TArray<UObject*>& Participants, int32 RandomSeed = 0)
 	{
-		return StartDialogueWithContext(TEXT("StartDialogue"), Dialogue, Participants);
+		return StartDialogueWithContext(TEXT("StartDialogue"), Dialogue, Participants, RandomSeed);
 	}
 
 	/**
@@ -136,23 +139,34 @@ public:
 
 	// Helper methods that allows you to start a Dialogue with only a participant
 	// For N Participants just use StartDialogue
-	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch")
-	static UDlgContext* StartMonologue(UDlgDialogue* Dialogue, UObject* Participant);
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch", meta = (AdvancedDisplay = "RandomSeed"))
+	static UDlgContext* StartMonologue(UDlgDialogue* Dialogue, UObject* Participant, int32 RandomSeed = 0);
+
+	/**
+	 * Fire and forget monologue for the ambient barks: enters the first satisfied child of the start nodes (following the selectors)
+	 * and returns what the node says. Reuses the bark context of the game instance (see UDlgSchedulerSubsystem), allocating a transient one
+	 * only when there is no game instance or the bark is fired by the enter events of another bark, see UDlgContext::EvaluateBark.
+	 * @param bRecordHistory Should the entered nodes be added to the dialogue memory? Needed only if the conditions check the visited nodes.
+	 * @param RandomSeed Seeds the random selectors for this bark, see UDlgContext::SetRandomSeed. 0 keeps the random seed.
+	 * @return true if a node was entered
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch", meta = (AdvancedDisplay = "RandomSeed"))
+	static bool EvaluateBark(UDlgDialogue* Dialogue, UObject* Participant, FDlgBarkResult& OutResult, bool bRecordHistory = false, int32 RandomSeed = 0);
 
 	// Helper methods that allows you to start a Dialogue with 2 participants
 	// For N Participants just use StartDialogue
-	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch")
-	static UDlgContext* StartDialogue2(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1);
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch", meta = (AdvancedDisplay = "RandomSeed"))
+	static UDlgContext* StartDialogue2(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1, int32 RandomSeed = 0);
 
 	// Helper methods that allows you to start a Dialogue with 3 participants
 	// For N Participants just use StartDialogue
-	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch")
-	static UDlgContext* StartDialogue3(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1, UObject* Participant2);
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch", meta = (AdvancedDisplay = "RandomSeed"))
+	static UDlgContext* StartDialogue3(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1, UObject* Participant2, int32 RandomSeed = 0);
 
 	// Helper methods that allows you to start a Dialogue with 4 participants
 	// For N Participants just use StartDialogue
-	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch")
-	static UDlgContext* StartDialogue4(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1, UObject* Participant2, UObject* Participant3);
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Launch", meta = (AdvancedDisplay = "RandomSeed"))
+	static UDlgContext* StartDialogue4(UDlgDialogue* Dialogue, UObject* Participant0, UObject* Participant1, UObject* Participant2, UObject* Participant3, int32 RandomSeed = 0);
 
 	/**
 	 * Loads all dialogues from the filesystem into memory
@@ -193,9 +207,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Dialogue|Memory")
 	static void ClearDialogueHistory();
 
-	// Gets the Dialogue History from the FDlgMemory.
+	// Gets a copy of the Dialogue History from the FDlgMemory.
 	UFUNCTION(BlueprintPure, Category = "Dialogue|Memory")
-	static const TMap<FGuid, FDlgHistory>& GetDialogueHistory();
+	static TMap<FGuid, FDlgHistory> GetDialogueHistory();
 
 	// Does the Object implement the Dialogue Participant Interface?
 	UFUNCTION(BlueprintPure, Category = "Dialogue|Helper")
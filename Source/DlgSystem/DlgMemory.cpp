@@ -1,7 +1,67 @@
 // Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
 #include "DlgMemory.h"
 #include "DlgHelper.h"
+#include "DlgSystemSettings.h"
+#include "DlgMemorySubsystem.h"
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgMemory
+FDlgMemory& FDlgMemory::Get(const UObject* WorldContextObject)
+{
+	if (GetDefault<UDlgSystemSettings>()->bDialogueHistoryPerGameInstance)
+	{
+		if (UDlgMemorySubsystem* Subsystem = UDlgMemorySubsystem::Get(WorldContextObject))
+		{
+			return Subsystem->GetMemory();
+		}
+	}
+
+	return Get();
+}
+
+void FDlgMemory::ModifyEntryLocked(const FGuid& DialogueGUID, TFunctionRef<void(FDlgHistory&)> Func)
+{
+	// Only the modified history is measured
+	const SIZE_T MapSizeBefore = HistoryMap.GetAllocatedSize();
+	FDlgHistory& History = HistoryMap.FindOrAdd(DialogueGUID);
+	const SIZE_T HistorySizeBefore = History.GetAllocatedSize();
+
+	Func(History);
+
+	AllocatedSize = AllocatedSize + HistoryMap.GetAllocatedSize() + History.GetAllocatedSize() - MapSizeBefore - HistorySizeBefore;
+}
+
+SIZE_T FDlgMemory::CountAllocatedSizeLocked() const
+{
+	SIZE_T Size = HistoryMap.GetAllocatedSize();
+	for (const auto& Elem : HistoryMap)
+	{
+		Size += Elem.Value.GetAllocatedSize();
+	}
+	return Size;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgNodeSavedData
+void FDlgNodeSavedData::ConvertGUIDListToUsedEdges(const TArray<FGuid>& EdgeTargetGUIDs)
+{
+	InitUsedEdges(EdgeTargetGUIDs.Num());
+	for (int32 EdgeIndex = 0; EdgeIndex < EdgeTargetGUIDs.Num(); ++EdgeIndex)
+	{
+		if (GUIDList.Contains(EdgeTargetGUIDs[EdgeIndex]))
+		{
+			SetEdgeUsed(EdgeIndex);
+		}
+		if (GUIDList.Num() > 0 && EdgeTargetGUIDs[EdgeIndex] == GUIDList.Last())
+		{
+			LastEdgeIndex = EdgeIndex;
+		}
+	}
+	GUIDList.Empty();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgHistory
 void FDlgHistory::Add(int32 NodeIndex, const FGuid& NodeGUID)
 {
 	if (NodeIndex >= 0)
@@ -37,3 +97,13 @@ FDlgNodeSavedData& FDlgHistory::GetNodeData(const FGuid& NodeGUID)
 	return NodeData.FindOrAdd(NodeGUID);
 }
 
+
+SIZE_T FDlgHistory::GetAllocatedSize() const
+{
+	SIZE_T Size = VisitedNodeIndices.GetAllocatedSize() + VisitedNodeGUIDs.GetAllocatedSize() + NodeData.GetAllocatedSize();
+	for (const auto& Elem : NodeData)
+	{
+		Size += Elem.Value.GetAllocatedSize();
+	}
+	return Size;
+}
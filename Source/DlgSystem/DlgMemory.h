@@ -2,6 +2,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
 
 #include "DlgMemory.generated.h"
 
@@ -13,10 +14,68 @@ struct DLGSYSTEM_API FDlgNodeSavedData
 	GENERATED_USTRUCT_BODY()
 
 public:
+	// Sizes the mask for the InNumEdges edges of the random selector node, the picks are forgotten if the number of edges changed.
+	// The state is stored per edge index, so it can not be kept after the edges of the node were edited.
+	// @return true if the picks were forgotten
+	bool InitUsedEdges(int32 InNumEdges)
+	{
+		if (NumEdges == InNumEdges)
+		{
+			return false;
+		}
+
+		NumEdges = InNumEdges;
+		LastEdgeIndex = INDEX_NONE;
+		UsedEdgesMask.Reset();
+		UsedEdgesMask.SetNumZeroed((InNumEdges + 31) / 32);
+		return true;
+	}
+
+	// Converts the GUIDList of the old saves to UsedEdgesMask and LastEdgeIndex, EdgeTargetGUIDs are the target node GUIDs of the edges
+	void ConvertGUIDListToUsedEdges(const TArray<FGuid>& EdgeTargetGUIDs);
+
+	// Was the edge at EdgeIndex already picked in the current cycle of the random selector node?
+	bool IsEdgeUsed(int32 EdgeIndex) const
+	{
+		const int32 WordIndex = EdgeIndex / 32;
+		return EdgeIndex >= 0 && UsedEdgesMask.IsValidIndex(WordIndex) && (UsedEdgesMask[WordIndex] & (1u << (EdgeIndex % 32))) != 0;
+	}
+
+	// Does not allocate, EdgeIndex must be in the range given to InitUsedEdges
+	void SetEdgeUsed(int32 EdgeIndex)
+	{
+		const int32 WordIndex = EdgeIndex / 32;
+		if (EdgeIndex >= 0 && UsedEdgesMask.IsValidIndex(WordIndex))
+		{
+			UsedEdgesMask[WordIndex] |= 1u << (EdgeIndex % 32);
+		}
+	}
+
+	// Starts a new cycle, keeps the memory of the mask
+	void ResetUsedEdges()
+	{
+		FMemory::Memzero(UsedEdgesMask.GetData(), UsedEdgesMask.Num() * sizeof(uint32));
+	}
+
+	SIZE_T GetAllocatedSize() const { return GUIDList.GetAllocatedSize() + UsedEdgesMask.GetAllocatedSize(); }
 
-	// used by random selector node to avoid repetition
+public:
+	// DEPRECATED, the target nodes picked by the random selector node. Only read from old saves, converted to UsedEdgesMask.
 	UPROPERTY()
 	TArray<FGuid> GUIDList;
+
+	// used by random selector node to avoid repetition, bit N is set if the edge N was picked in the current cycle
+	// Sized once for the edges of the node by InitUsedEdges, picking does not allocate after that
+	UPROPERTY()
+	TArray<uint32> UsedEdgesMask;
+
+	// The number of edges UsedEdgesMask and LastEdgeIndex were recorded for
+	UPROPERTY()
+	int32 NumEdges = 0;
+
+	// The edge picked the last time by the random selector node
+	UPROPERTY()
+	int32 LastEdgeIndex = INDEX_NONE;
 };
 
 
@@ -70,8 +129,12 @@ public:
 
 	bool operator==(const FDlgHistory& Other) const;
 
+	// NOTE: not locked, use FDlgMemory::ModifyNodeData for the histories stored in the memory
 	FDlgNodeSavedData& GetNodeData(const FGuid& NodeGUID);
 
+	// Memory used by the containers of this history
+	SIZE_T GetAllocatedSize() const;
+
 public:
 	// Sed of already visited Node indices
 	// NOTE: if you serialize this but then later change the dialogue node positions this will have the wrong indices
@@ -91,14 +154,26 @@ public:
 	TMap<FGuid, FDlgNodeSavedData> NodeData;
 };
 
-// Singleton to store Dialogue history
-// TODO: investigate if this is multiplayer friendly, it does not seem so as there exists only a single global dialogue memory
+// Stores the Dialogue history
+// The global instance is used by default, with UDlgSystemSettings::bDialogueHistoryPerGameInstance each game instance has its own,
+// see UDlgMemorySubsystem. All the functions are safe to call from multiple threads (the writes lock out the readers),
+// except the unsafe internals returning references into the map.
 USTRUCT()
 struct DLGSYSTEM_API FDlgMemory
 {
 	GENERATED_USTRUCT_BODY()
 public:
 	FDlgMemory() {}
+	FDlgMemory(const FDlgMemory& Other) { SetHistoryMap(Other.GetHistoryMapsCopy()); }
+	FDlgMemory& operator=(const FDlgMemory& Other)
+	{
+		if (this != &Other)
+		{
+			SetHistoryMap(Other.GetHistoryMapsCopy());
+		}
+		return *this;
+	}
+
 	static FDlgMemory* GetInstance()
 	{
 		static FDlgMemory Instance;
@@ -111,38 +186,73 @@ public:
 		return *Instance;
 	}
 
+	// The memory of the game instance of the WorldContextObject if bDialogueHistoryPerGameInstance is enabled, the global one otherwise
+	static FDlgMemory& Get(const UObject* WorldContextObject);
+
 	// Removes all entries
-	void Empty() { HistoryMap.Empty(); }
+	void Empty()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		HistoryMap.Empty();
+		AllocatedSize = 0;
+	}
 
 	// Adds an entry to the map or overrides an existing one
 	void SetEntry(const FGuid& DialogueGUID, const FDlgHistory& History)
 	{
-		FDlgHistory* OldEntry = HistoryMap.Find(DialogueGUID);
-
-		if (OldEntry == nullptr)
+		FWriteScopeLock WriteLock(Lock);
+		ModifyEntryLocked(DialogueGUID, [&History](FDlgHistory& Entry)
 		{
-			HistoryMap.Add(DialogueGUID, History);
-		}
-		else
+			Entry = History;
+		});
+	}
+
+	// Copies the entry for the given Dialogue into OutHistory, returns false if it does not exist
+	bool GetEntryCopy(const FGuid& DialogueGUID, FDlgHistory& OutHistory) const
+	{
+		FReadScopeLock ReadLock(Lock);
+		const FDlgHistory* History = HistoryMap.Find(DialogueGUID);
+		if (History == nullptr)
 		{
-			*OldEntry = History;
+			return false;
 		}
+
+		OutHistory = *History;
+		return true;
 	}
 
-	// Returns the entry for the given name, or nullptr if it does not exist */
-	FDlgHistory* GetEntry(const FGuid& DialogueGUID) { return HistoryMap.Find(DialogueGUID); }
+	// Calls Func with the entry for the given Dialogue (added if it does not exist) under the write lock
+	// NOTE: Func must not call into this memory again, the lock is not reentrant
+	void ModifyEntry(const FGuid& DialogueGUID, TFunctionRef<void(FDlgHistory&)> Func)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		ModifyEntryLocked(DialogueGUID, Func);
+	}
 
-	FDlgHistory& FindOrAddEntry(const FGuid& DialogueGUID) { return HistoryMap.FindOrAdd(DialogueGUID); }
+	// Calls Func with the data of the node (added if it does not exist) under the write lock, see ModifyEntry
+	void ModifyNodeData(const FGuid& DialogueGUID, const FGuid& NodeGUID, TFunctionRef<void(FDlgNodeSavedData&)> Func)
+	{
+		ModifyEntry(DialogueGUID, [&NodeGUID, &Func](FDlgHistory& History)
+		{
+			Func(History.GetNodeData(NodeGUID));
+		});
+	}
 
 	void SetNodeVisited(const FGuid& DialogueGUID, int32 NodeIndex, const FGuid& NodeGUID)
 	{
+		FWriteScopeLock WriteLock(Lock);
+
 		// Add it if it does not exist already
-		FDlgHistory& History = HistoryMap.FindOrAdd(DialogueGUID);
-		History.Add(NodeIndex, NodeGUID);
+		ModifyEntryLocked(DialogueGUID, [NodeIndex, &NodeGUID](FDlgHistory& History)
+		{
+			History.Add(NodeIndex, NodeGUID);
+		});
 	}
 
 	bool IsNodeVisited(const FGuid& DialogueGUID, int32 NodeIndex, const FGuid& NodeGUID) const
 	{
+		FReadScopeLock ReadLock(Lock);
+
 		// Dialogue entry does not even exist
 		const FDlgHistory* History = HistoryMap.Find(DialogueGUID);
 		if (History == nullptr)
@@ -155,6 +265,8 @@ public:
 
 	bool IsNodeIndexVisited(const FGuid& DialogueGUID, int32 NodeIndex) const
 	{
+		FReadScopeLock ReadLock(Lock);
+
 		// Dialogue entry does not even exist
 		const FDlgHistory* History = HistoryMap.Find(DialogueGUID);
 		if (History == nullptr)
@@ -167,6 +279,8 @@ public:
 
 	bool IsNodeGUIDVisited(const FGuid& DialogueGUID, const FGuid& NodeGUID) const
 	{
+		FReadScopeLock ReadLock(Lock);
+
 		// Dialogue entry does not even exist
 		const FDlgHistory* History = HistoryMap.Find(DialogueGUID);
 		if (History == nullptr)
@@ -177,14 +291,70 @@ public:
 		return History->VisitedNodeGUIDs.Contains(NodeGUID);
 	}
 
-	const TMap<FGuid, FDlgHistory>& GetHistoryMaps() const { return HistoryMap; }
-	void SetHistoryMap(const TMap<FGuid, FDlgHistory>& Map) { HistoryMap = Map; }
+	// Memory used by all the histories, a running counter updated by the writes, nothing is scanned
+	// NOTE: the changes made through the unsafe internals are not counted, call RecountAllocatedSize after them
+	SIZE_T GetAllocatedSize() const
+	{
+		FReadScopeLock ReadLock(Lock);
+		return AllocatedSize;
+	}
+
+	// Scans all the histories to reset the counter of GetAllocatedSize
+	void RecountAllocatedSize()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		AllocatedSize = CountAllocatedSizeLocked();
+	}
+
+	TMap<FGuid, FDlgHistory> GetHistoryMapsCopy() const
+	{
+		FReadScopeLock ReadLock(Lock);
+		return HistoryMap;
+	}
+	void SetHistoryMap(const TMap<FGuid, FDlgHistory>& Map)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		HistoryMap = Map;
+		AllocatedSize = CountAllocatedSizeLocked();
+	}
+
+	//
+	// Unsafe internals, the returned references into the map are not guarded by the lock.
+	// A write from another thread may reallocate the map while they are used, only use them when no other thread can
+	// access this memory (e.g. while loading a save game). Use the functions above otherwise.
+	//
+
+	FDlgHistory* GetEntryUnsafe(const FGuid& DialogueGUID) { return HistoryMap.Find(DialogueGUID); }
+	FDlgHistory& FindOrAddEntryUnsafe(const FGuid& DialogueGUID) { return HistoryMap.FindOrAdd(DialogueGUID); }
+	const TMap<FGuid, FDlgHistory>& GetHistoryMapsUnsafe() const { return HistoryMap; }
+
+	UE_DEPRECATED(5.0, "GetEntry is not thread safe, use GetEntryCopy, ModifyEntry or GetEntryUnsafe")
+	FDlgHistory* GetEntry(const FGuid& DialogueGUID) { return GetEntryUnsafe(DialogueGUID); }
+
+	UE_DEPRECATED(5.0, "FindOrAddEntry is not thread safe, use ModifyEntry or FindOrAddEntryUnsafe")
+	FDlgHistory& FindOrAddEntry(const FGuid& DialogueGUID) { return FindOrAddEntryUnsafe(DialogueGUID); }
+
+	UE_DEPRECATED(5.0, "GetHistoryMaps is not thread safe, use GetHistoryMapsCopy or GetHistoryMapsUnsafe")
+	const TMap<FGuid, FDlgHistory>& GetHistoryMaps() const { return GetHistoryMapsUnsafe(); }
+
+private:
+	// Calls Func with the entry (added if it does not exist) and adds the change of the size to AllocatedSize, the write lock must be held
+	void ModifyEntryLocked(const FGuid& DialogueGUID, TFunctionRef<void(FDlgHistory&)> Func);
+
+	// Scans all the histories, the lock must be held
+	SIZE_T CountAllocatedSizeLocked() const;
 
 private:
 	 // Key: Dialogue unique identifier GUID
 	 // Value: set of already visited nodes
 	UPROPERTY()
 	TMap<FGuid, FDlgHistory> HistoryMap;
+
+	// Guards the HistoryMap
+	mutable FRWLock Lock;
+
+	// See GetAllocatedSize
+	SIZE_T AllocatedSize = 0;
 };
 
 template<>
@@ -0,0 +1,30 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgMemorySubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+#include "DlgSystemSettings.h"
+
+UDlgMemorySubsystem* UDlgMemorySubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	const UGameInstance* GameInstance = World->GetGameInstance();
+	return GameInstance ? GameInstance->GetSubsystem<UDlgMemorySubsystem>() : nullptr;
+}
+
+bool UDlgMemorySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return GetDefault<UDlgSystemSettings>()->bDialogueHistoryPerGameInstance;
+}
@@ -0,0 +1,45 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+
+#include "DlgMemory.h"
+
+#include "DlgMemorySubsystem.generated.h"
+
+/**
+ * The dialogue history of a single game instance.
+ * Only created if UDlgSystemSettings::bDialogueHistoryPerGameInstance is enabled, otherwise the global FDlgMemory is used.
+ */
+UCLASS()
+class DLGSYSTEM_API UDlgMemorySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Gets the subsystem of the game instance of the WorldContextObject, nullptr if there is none
+	static UDlgMemorySubsystem* Get(const UObject* WorldContextObject);
+
+	//~ USubsystem interface
+	bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	FDlgMemory& GetMemory() { return Memory; }
+	const FDlgMemory& GetMemory() const { return Memory; }
+
+	// Sets the Dialogue history of this game instance.
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Memory")
+	void SetDialogueHistory(const TMap<FGuid, FDlgHistory>& DlgHistory) { Memory.SetHistoryMap(DlgHistory); }
+
+	// Empties the Dialogue history of this game instance.
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Memory")
+	void ClearDialogueHistory() { Memory.Empty(); }
+
+	// Gets a copy of the Dialogue history of this game instance.
+	UFUNCTION(BlueprintPure, Category = "Dialogue|Memory")
+	TMap<FGuid, FDlgHistory> GetDialogueHistory() const { return Memory.GetHistoryMapsCopy(); }
+
+protected:
+	UPROPERTY()
+	FDlgMemory Memory;
+};
@@ -0,0 +1,175 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgParticipantCaller.h"
+
+#include "NYEngineVersionHelpers.h"
+
+TMap<FObjectKey, uint32> FDlgParticipantCaller::NativeFunctionsMasks;
+FRWLock FDlgParticipantCaller::NativeFunctionsMasksLock;
+
+// The names of the functions in the order of EDlgParticipantFunction
+static const FName ParticipantFunctionNames[] =
+{
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, CheckCondition),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, GetFloatValue),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, GetIntValue),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, GetBoolValue),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, GetNameValue),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, OnDialogueEvent),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, ModifyFloatValue),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, ModifyIntValue),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, ModifyBoolValue),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, ModifyNameValue),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, GetParticipantDisplayName),
+	GET_FUNCTION_NAME_CHECKED(IDlgDialogueParticipant, GetParticipantGender)
+};
+static_assert(NY_ARRAY_COUNT(ParticipantFunctionNames) == static_cast<int32>(EDlgParticipantFunction::Num), "ParticipantFunctionNames must match EDlgParticipantFunction");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgParticipantCaller::ClearCache()
+{
+	FWriteScopeLock WriteLock(NativeFunctionsMasksLock);
+	NativeFunctionsMasks.Empty();
+}
+
+uint32 FDlgParticipantCaller::GetNativeFunctionsMask(const UClass* Class)
+{
+	{
+		FReadScopeLock ReadLock(NativeFunctionsMasksLock);
+		if (const uint32* CachedMask = NativeFunctionsMasks.Find(Class))
+		{
+			return *CachedMask;
+		}
+	}
+
+	// Only the classes implementing the interface in C++ have the _Implementation functions
+	uint32 Mask = 0;
+	const UObject* ClassDefaultObject = Class->GetDefaultObject(false);
+	if (ClassDefaultObject && ClassDefaultObject->GetNativeInterfaceAddress(UDlgDialogueParticipant::StaticClass()))
+	{
+		for (int32 FunctionIndex = 0; FunctionIndex < static_cast<int32>(EDlgParticipantFunction::Num); FunctionIndex++)
+		{
+			// A Blueprint override is found before the native function and is not native
+			const UFunction* Function = Class->FindFunctionByName(ParticipantFunctionNames[FunctionIndex]);
+			if (Function && Function->HasAnyFunctionFlags(FUNC_Native))
+			{
+				Mask |= 1u << FunctionIndex;
+			}
+		}
+	}
+
+	// Another thread might have added the same mask in the meantime, it is the same value
+	FWriteScopeLock WriteLock(NativeFunctionsMasksLock);
+	NativeFunctionsMasks.Add(Class, Mask);
+	return Mask;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgParticipantCaller::CheckCondition(const UObject* Participant, const UDlgContext* Context, FName ConditionName)
+{
+	if (const IDlgDialogueParticipant* NativeParticipant = GetNativeParticipant(Participant, EDlgParticipantFunction::CheckCondition))
+	{
+		return NativeParticipant->CheckCondition_Implementation(Context, ConditionName);
+	}
+	return IDlgDialogueParticipant::Execute_CheckCondition(Participant, Context, ConditionName);
+}
+
+float FDlgParticipantCaller::GetFloatValue(const UObject* Participant, FName ValueName)
+{
+	if (const IDlgDialogueParticipant* NativeParticipant = GetNativeParticipant(Participant, EDlgParticipantFunction::GetFloatValue))
+	{
+		return NativeParticipant->GetFloatValue_Implementation(ValueName);
+	}
+	return IDlgDialogueParticipant::Execute_GetFloatValue(Participant, ValueName);
+}
+
+int32 FDlgParticipantCaller::GetIntValue(const UObject* Participant, FName ValueName)
+{
+	if (const IDlgDialogueParticipant* NativeParticipant = GetNativeParticipant(Participant, EDlgParticipantFunction::GetIntValue))
+	{
+		return NativeParticipant->GetIntValue_Implementation(ValueName);
+	}
+	return IDlgDialogueParticipant::Execute_GetIntValue(Participant, ValueName);
+}
+
+bool FDlgParticipantCaller::GetBoolValue(const UObject* Participant, FName ValueName)
+{
+	if (const IDlgDialogueParticipant* NativeParticipant = GetNativeParticipant(Participant, EDlgParticipantFunction::GetBoolValue))
+	{
+		return NativeParticipant->GetBoolValue_Implementation(ValueName);
+	}
+	return IDlgDialogueParticipant::Execute_GetBoolValue(Participant, ValueName);
+}
+
+FName FDlgParticipantCaller::GetNameValue(const UObject* Participant, FName ValueName)
+{
+	if (const IDlgDialogueParticipant* NativeParticipant = GetNativeParticipant(Participant, EDlgParticipantFunction::GetNameValue))
+	{
+		return NativeParticipant->GetNameValue_Implementation(ValueName);
+	}
+	return IDlgDialogueParticipant::Execute_GetNameValue(Participant, ValueName);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgParticipantCaller::OnDialogueEvent(UObject* Participant, UDlgContext* Context, FName EventName)
+{
+	if (IDlgDialogueParticipant* NativeParticipant = GetMutableNativeParticipant(Participant, EDlgParticipantFunction::OnDialogueEvent))
+	{
+		return NativeParticipant->OnDialogueEvent_Implementation(Context, EventName);
+	}
+	return IDlgDialogueParticipant::Execute_OnDialogueEvent(Participant, Context, EventName);
+}
+
+bool FDlgParticipantCaller::ModifyFloatValue(UObject* Participant, FName ValueName, bool bDelta, float Value)
+{
+	if (IDlgDialogueParticipant* NativeParticipant = GetMutableNativeParticipant(Participant, EDlgParticipantFunction::ModifyFloatValue))
+	{
+		return NativeParticipant->ModifyFloatValue_Implementation(ValueName, bDelta, Value);
+	}
+	return IDlgDialogueParticipant::Execute_ModifyFloatValue(Participant, ValueName, bDelta, Value);
+}
+
+bool FDlgParticipantCaller::ModifyIntValue(UObject* Participant, FName ValueName, bool bDelta, int32 Value)
+{
+	if (IDlgDialogueParticipant* NativeParticipant = GetMutableNativeParticipant(Participant, EDlgParticipantFunction::ModifyIntValue))
+	{
+		return NativeParticipant->ModifyIntValue_Implementation(ValueName, bDelta, Value);
+	}
+	return IDlgDialogueParticipant::Execute_ModifyIntValue(Participant, ValueName, bDelta, Value);
+}
+
+bool FDlgParticipantCaller::ModifyBoolValue(UObject* Participant, FName ValueName, bool bNewValue)
+{
+	if (IDlgDialogueParticipant* NativeParticipant = GetMutableNativeParticipant(Participant, EDlgParticipantFunction::ModifyBoolValue))
+	{
+		return NativeParticipant->ModifyBoolValue_Implementation(ValueName, bNewValue);
+	}
+	return IDlgDialogueParticipant::Execute_ModifyBoolValue(Participant, ValueName, bNewValue);
+}
+
+bool FDlgParticipantCaller::ModifyNameValue(UObject* Participant, FName ValueName, FName NameValue)
+{
+	if (IDlgDialogueParticipant* NativeParticipant = GetMutableNativeParticipant(Participant, EDlgParticipantFunction::ModifyNameValue))
+	{
+		return NativeParticipant->ModifyNameValue_Implementation(ValueName, NameValue);
+	}
+	return IDlgDialogueParticipant::Execute_ModifyNameValue(Participant, ValueName, NameValue);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FText FDlgParticipantCaller::GetParticipantDisplayName(const UObject* Participant, FName ActiveSpeaker)
+{
+	if (const IDlgDialogueParticipant* NativeParticipant = GetNativeParticipant(Participant, EDlgParticipantFunction::GetParticipantDisplayName))
+	{
+		return NativeParticipant->GetParticipantDisplayName_Implementation(ActiveSpeaker);
+	}
+	return IDlgDialogueParticipant::Execute_GetParticipantDisplayName(Participant, ActiveSpeaker);
+}
+
+ETextGender FDlgParticipantCaller::GetParticipantGender(const UObject* Participant)
+{
+	if (const IDlgDialogueParticipant* NativeParticipant = GetNativeParticipant(Participant, EDlgParticipantFunction::GetParticipantGender))
+	{
+		return NativeParticipant->GetParticipantGender_Implementation();
+	}
+	return IDlgDialogueParticipant::Execute_GetParticipantGender(Participant);
+}
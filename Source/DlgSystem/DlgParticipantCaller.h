@@ -0,0 +1,90 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "Misc/ScopeRWLock.h"
+
+#include "DlgDialogueParticipant.h"
+
+class UDlgContext;
+
+// The IDlgDialogueParticipant functions called by the conditions, events and text arguments
+enum class EDlgParticipantFunction : uint8
+{
+	CheckCondition = 0,
+	GetFloatValue,
+	GetIntValue,
+	GetBoolValue,
+	GetNameValue,
+	OnDialogueEvent,
+	ModifyFloatValue,
+	ModifyIntValue,
+	ModifyBoolValue,
+	ModifyNameValue,
+	GetParticipantDisplayName,
+	GetParticipantGender,
+
+	Num
+};
+
+/**
+ * Calls the IDlgDialogueParticipant functions of a participant.
+ * The Execute_ functions always go through ProcessEvent, even if the participant implements the function in C++.
+ * If the class of the participant implements the interface in C++ and no Blueprint subclass overrides the function,
+ * the _Implementation is called directly instead. This is checked only once for each participant class.
+ */
+class DLGSYSTEM_API FDlgParticipantCaller
+{
+	typedef FDlgParticipantCaller Self;
+
+public:
+	// Conditions
+	static bool CheckCondition(const UObject* Participant, const UDlgContext* Context, FName ConditionName);
+	static float GetFloatValue(const UObject* Participant, FName ValueName);
+	static int32 GetIntValue(const UObject* Participant, FName ValueName);
+	static bool GetBoolValue(const UObject* Participant, FName ValueName);
+	static FName GetNameValue(const UObject* Participant, FName ValueName);
+
+	// Events
+	static bool OnDialogueEvent(UObject* Participant, UDlgContext* Context, FName EventName);
+	static bool ModifyFloatValue(UObject* Participant, FName ValueName, bool bDelta, float Value);
+	static bool ModifyIntValue(UObject* Participant, FName ValueName, bool bDelta, int32 Value);
+	static bool ModifyBoolValue(UObject* Participant, FName ValueName, bool bNewValue);
+	static bool ModifyNameValue(UObject* Participant, FName ValueName, FName NameValue);
+
+	// Text arguments
+	static FText GetParticipantDisplayName(const UObject* Participant, FName ActiveSpeaker);
+	static ETextGender GetParticipantGender(const UObject* Participant);
+
+	// Can the Function of the Participant be called directly?
+	static bool IsNativeFunction(const UObject* Participant, EDlgParticipantFunction Function)
+	{
+		return (GetNativeFunctionsMask(Participant->GetClass()) & (1u << static_cast<uint32>(Function))) != 0;
+	}
+
+	// Forgets the cached classes, only needed if the classes change (e.g. the Blueprints are recompiled in the editor)
+	static void ClearCache();
+
+protected:
+	// The native interface of the Participant if the Function can be called directly, nullptr otherwise
+	static const IDlgDialogueParticipant* GetNativeParticipant(const UObject* Participant, EDlgParticipantFunction Function)
+	{
+		return IsNativeFunction(Participant, Function)
+			? static_cast<const IDlgDialogueParticipant*>(Participant->GetNativeInterfaceAddress(UDlgDialogueParticipant::StaticClass()))
+			: nullptr;
+	}
+	static IDlgDialogueParticipant* GetMutableNativeParticipant(UObject* Participant, EDlgParticipantFunction Function)
+	{
+		return const_cast<IDlgDialogueParticipant*>(GetNativeParticipant(Participant, Function));
+	}
+
+	// Bit N is set if the EDlgParticipantFunction N of the Class can be called directly
+	static uint32 GetNativeFunctionsMask(const UClass* Class);
+
+protected:
+	// Key: Class of the participant
+	// The participants can be called from multiple threads, only read and written under the NativeFunctionsMasksLock
+	static TMap<FObjectKey, uint32> NativeFunctionsMasks;
+	static FRWLock NativeFunctionsMasksLock;
+};
@@ -0,0 +1,69 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgRuntimeStats.h"
+
+#include "DlgContext.h"
+#include "DlgCondition.h"
+#include "DlgConditionCustom.h"
+
+void FDlgRuntimeStats::ResetTimings()
+{
+	ConditionsStats.Empty();
+	ReevaluateOptionsStats = {};
+	TextFormatStats = {};
+}
+
+TArray<const UDlgContext*> FDlgRuntimeStats::GetActiveContexts() const
+{
+	TArray<const UDlgContext*> ActiveContexts;
+	for (const UDlgContext* Context : Contexts)
+	{
+		if (IsValid(Context) && !Context->HasDialogueEnded())
+		{
+			ActiveContexts.Add(Context);
+		}
+	}
+	return ActiveContexts;
+}
+
+FDlgRuntimeTimingStats* FDlgRuntimeStats::AddConditionEvaluation(const FDlgCondition& Condition)
+{
+	NumConditionEvaluations++;
+	if (!bEnabled)
+	{
+		return nullptr;
+	}
+
+	// Conditions without a callback are grouped by their type
+	FName Name = Condition.CallbackName;
+	if (Condition.ConditionType == EDlgConditionType::Custom)
+	{
+		Name = Condition.CustomCondition ? Condition.CustomCondition->GetClass()->GetFName() : NAME_None;
+	}
+	else if (Name.IsNone())
+	{
+		Name = FName(*FDlgCondition::ConditionTypeToString(Condition.ConditionType));
+	}
+
+	return &ConditionsStats.FindOrAdd(Name);
+}
+
+TArray<TPair<FName, FDlgRuntimeTimingStats>> FDlgRuntimeStats::GetMostExpensiveConditions(int32 Num) const
+{
+	TArray<TPair<FName, FDlgRuntimeTimingStats>> Conditions;
+	Conditions.Reserve(ConditionsStats.Num());
+	for (const auto& Elem : ConditionsStats)
+	{
+		Conditions.Emplace(Elem.Key, Elem.Value);
+	}
+
+	Conditions.Sort([](const TPair<FName, FDlgRuntimeTimingStats>& A, const TPair<FName, FDlgRuntimeTimingStats>& B)
+	{
+		return A.Value.TotalCycles > B.Value.TotalCycles;
+	});
+	if (Conditions.Num() > Num)
+	{
+		Conditions.SetNum(Num);
+	}
+
+	return Conditions;
+}
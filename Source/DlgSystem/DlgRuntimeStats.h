@@ -0,0 +1,127 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+class UDlgContext;
+struct FDlgCondition;
+
+// Number of calls and the time spent in them
+struct DLGSYSTEM_API FDlgRuntimeTimingStats
+{
+public:
+	void Add(uint64 Cycles)
+	{
+		Num++;
+		TotalCycles += Cycles;
+		PeakCycles = FMath::Max(PeakCycles, Cycles);
+	}
+
+	double GetTotalMs() const { return FPlatformTime::ToMilliseconds64(TotalCycles); }
+	double GetPeakMs() const { return FPlatformTime::ToMilliseconds64(PeakCycles); }
+	double GetAverageMs() const { return Num > 0 ? GetTotalMs() / static_cast<double>(Num) : 0.0; }
+
+public:
+	int64 Num = 0;
+	uint64 TotalCycles = 0;
+	uint64 PeakCycles = 0;
+};
+
+/**
+ * Cheap counters maintained by the dialogue runtime, displayed by the gameplay debugger category.
+ * The counters are always updated, the timings are only measured while enabled.
+ */
+class DLGSYSTEM_API FDlgRuntimeStats
+{
+	typedef FDlgRuntimeStats Self;
+
+public:
+	static FDlgRuntimeStats& Get()
+	{
+		static FDlgRuntimeStats Instance;
+		return Instance;
+	}
+
+	// Should we measure the timings?
+	bool IsEnabled() const { return bEnabled; }
+	void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+
+	// Removes all the timings
+	void ResetTimings();
+
+	//
+	// Dialogues
+	//
+
+	void AddLoadedDialogue() { NumLoadedDialogues++; }
+	void RemoveLoadedDialogue() { NumLoadedDialogues--; }
+	int32 GetNumLoadedDialogues() const { return NumLoadedDialogues; }
+
+	//
+	// Contexts
+	//
+
+	void AddContext(const UDlgContext* Context) { Contexts.Add(Context); }
+	void RemoveContext(const UDlgContext* Context) { Contexts.Remove(Context); }
+
+	// All the contexts that did not end yet
+	TArray<const UDlgContext*> GetActiveContexts() const;
+
+	//
+	// Conditions
+	//
+
+	// The number of conditions evaluated since the start
+	int64 GetNumConditionEvaluations() const { return NumConditionEvaluations; }
+
+	// Counts the evaluation, returns the timing stats of the Condition only if enabled
+	FDlgRuntimeTimingStats* AddConditionEvaluation(const FDlgCondition& Condition);
+
+	// The Num most expensive conditions by total time, sorted in descending order
+	TArray<TPair<FName, FDlgRuntimeTimingStats>> GetMostExpensiveConditions(int32 Num) const;
+
+	//
+	// Timings
+	//
+
+	FDlgRuntimeTimingStats* GetReevaluateOptionsStats() { return bEnabled ? &ReevaluateOptionsStats : nullptr; }
+	const FDlgRuntimeTimingStats& GetReevaluateOptionsStats() const { return ReevaluateOptionsStats; }
+
+	FDlgRuntimeTimingStats* GetTextFormatStats() { return bEnabled ? &TextFormatStats : nullptr; }
+	const FDlgRuntimeTimingStats& GetTextFormatStats() const { return TextFormatStats; }
+
+protected:
+	bool bEnabled = false;
+
+	int32 NumLoadedDialogues = 0;
+	int64 NumConditionEvaluations = 0;
+
+	// All the contexts that were started and not destroyed yet
+	TSet<const UDlgContext*> Contexts;
+
+	// Key: Callback name of the condition (or type for the conditions without one)
+	TMap<FName, FDlgRuntimeTimingStats> ConditionsStats;
+
+	FDlgRuntimeTimingStats ReevaluateOptionsStats;
+	FDlgRuntimeTimingStats TextFormatStats;
+};
+
+// Adds the time spent in the scope to Stats, does nothing for null Stats
+struct FDlgScopedRuntimeTimer
+{
+	FDlgScopedRuntimeTimer(FDlgRuntimeTimingStats* InStats)
+		: Stats(InStats), StartCycles(InStats ? FPlatformTime::Cycles64() : 0) {}
+
+	~FDlgScopedRuntimeTimer()
+	{
+		if (Stats)
+		{
+			Stats->Add(FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+private:
+	FDlgRuntimeTimingStats* Stats;
+	uint64 StartCycles;
+};
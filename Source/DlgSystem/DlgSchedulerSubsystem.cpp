@@ -0,0 +1,136 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgSchedulerSubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+#include "DlgSystemSettings.h"
+#include "DlgManager.h"
+#include "DlgContext.h"
+#include "Logging/DlgLogger.h"
+
+UDlgSchedulerSubsystem* UDlgSchedulerSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	const UGameInstance* GameInstance = World->GetGameInstance();
+	return GameInstance ? GameInstance->GetSubsystem<UDlgSchedulerSubsystem>() : nullptr;
+}
+
+void UDlgSchedulerSubsystem::Deinitialize()
+{
+	// Nothing is started while the game instance shuts down
+	Queue.Empty();
+	BarkContext = nullptr;
+	Super::Deinitialize();
+}
+
+UDlgContext* UDlgSchedulerSubsystem::GetBarkContext()
+{
+	if (!BarkContext)
+	{
+		BarkContext = NewObject<UDlgContext>(this);
+	}
+	return BarkContext;
+}
+
+TStatId UDlgSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDlgSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+void UDlgSchedulerSubsystem::Tick(float DeltaTime)
+{
+	const double BudgetSeconds = GetDefault<UDlgSystemSettings>()->DialogueSchedulerBudgetMs / 1000.0;
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	// At least one each frame, so the queue is always drained
+	do
+	{
+		FDlgScheduledDialogue Request;
+		Queue.HeapPop(Request, &ThisClass::IsStartedBefore);
+		StartScheduledDialogue(Request);
+	}
+	while (Queue.Num() > 0 && FPlatformTime::Seconds() - StartSeconds < BudgetSeconds);
+}
+
+int32 UDlgSchedulerSubsystem::ScheduleDialogue(
+	UDlgDialogue* Dialogue,
+	const TArray<UObject*>& Participants,
+	float Priority,
+	const FDlgOnScheduledDialogueStarted& OnStarted,
+	int32 RandomSeed
+)
+{
+	FDlgScheduledDialogue Request;
+	Request.RequestId = ++LastRequestId;
+	Request.Priority = Priority;
+	Request.Dialogue = Dialogue;
+	Request.Participants.Reserve(Participants.Num());
+	for (UObject* Participant : Participants)
+	{
+		Request.Participants.Add(Participant);
+	}
+	Request.OnStarted = OnStarted;
+	Request.RandomSeed = RandomSeed;
+
+	const int32 RequestId = Request.RequestId;
+	Queue.HeapPush(MoveTemp(Request), &ThisClass::IsStartedBefore);
+	return RequestId;
+}
+
+bool UDlgSchedulerSubsystem::CancelScheduledDialogue(int32 RequestId)
+{
+	const int32 Index = Queue.IndexOfByPredicate([RequestId](const FDlgScheduledDialogue& Request)
+	{
+		return Request.RequestId == RequestId;
+	});
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Queue.HeapRemoveAt(Index, &ThisClass::IsStartedBefore);
+	return true;
+}
+
+void UDlgSchedulerSubsystem::StartScheduledDialogue(const FDlgScheduledDialogue& Request)
+{
+	UDlgContext* Context = nullptr;
+
+	UDlgDialogue* Dialogue = Request.Dialogue.Get();
+	TArray<UObject*> Participants;
+	Participants.Reserve(Request.Participants.Num());
+	for (const TWeakObjectPtr<UObject>& Participant : Request.Participants)
+	{
+		if (Participant.IsValid())
+		{
+			Participants.Add(Participant.Get());
+		}
+	}
+
+	if (Dialogue && Participants.Num() > 0 && Participants.Num() == Request.Participants.Num())
+	{
+		Context = UDlgManager::StartDialogueWithContext(TEXT("DlgScheduler"), Dialogue, Participants, Request.RandomSeed);
+	}
+	else
+	{
+		FDlgLogger::Get().Warningf(
+			TEXT("DlgScheduler - Scheduled dialogue with RequestId = %d not started, the Dialogue or one of its participants was destroyed while it was in the queue"),
+			Request.RequestId
+		);
+	}
+
+	Request.OnStarted.ExecuteIfBound(Request.RequestId, Context);
+	OnScheduledDialogueStarted.Broadcast(Request.RequestId, Context);
+}
@@ -0,0 +1,102 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+
+#include "DlgSchedulerSubsystem.generated.h"
+
+class UDlgContext;
+class UDlgDialogue;
+
+// Called when a scheduled dialogue was started, Context is nullptr if it failed to start
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FDlgOnScheduledDialogueStarted, int32, RequestId, UDlgContext*, Context);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FDlgOnScheduledDialogueStartedMulticast, int32, RequestId, UDlgContext*, Context);
+
+// A dialogue waiting in the queue of the UDlgSchedulerSubsystem
+struct DLGSYSTEM_API FDlgScheduledDialogue
+{
+public:
+	int32 RequestId = INDEX_NONE;
+	float Priority = 0.f;
+
+	// Not kept alive by the queue, the request fails if any of them is destroyed before it is started
+	TWeakObjectPtr<UDlgDialogue> Dialogue;
+	TArray<TWeakObjectPtr<UObject>> Participants;
+
+	// See UDlgContext::SetRandomSeed, 0 keeps the random seed
+	int32 RandomSeed = 0;
+
+	FDlgOnScheduledDialogueStarted OnStarted;
+};
+
+/**
+ * Starts the dialogues of a game instance over multiple frames instead of all at once.
+ * The queued dialogues are started in the order of their priority (the same priority in the order they were scheduled),
+ * each frame until UDlgSystemSettings::DialogueSchedulerBudgetMs is spent.
+ * Also owns the context reused by the barks of the game instance, see UDlgManager::EvaluateBark.
+ */
+UCLASS()
+class DLGSYSTEM_API UDlgSchedulerSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// Gets the subsystem of the game instance of the WorldContextObject, nullptr if there is none
+	UFUNCTION(BlueprintPure, Category = "Dialogue|Scheduler", meta = (WorldContext = "WorldContextObject"))
+	static UDlgSchedulerSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ USubsystem interface
+	void Deinitialize() override;
+
+	//~ FTickableGameObject interface
+	void Tick(float DeltaTime) override;
+	bool IsTickable() const override { return Queue.Num() > 0; }
+	bool IsTickableWhenPaused() const override { return true; }
+	ETickableTickType GetTickableTickType() const override { return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional; }
+	TStatId GetStatId() const override;
+
+	/**
+	 * Queues the start of the Dialogue, same as UDlgManager::StartDialogue once it is its turn.
+	 * @param Priority Higher priorities are started first, e.g. the negative distance to the player
+	 * @param RandomSeed Seeds the random selectors of the started context, see UDlgContext::SetRandomSeed. 0 keeps the random seed.
+	 * @return the id of the request, passed to the delegates
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Scheduler", meta = (AdvancedDisplay = "RandomSeed"))
+	int32 ScheduleDialogue(UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, float Priority, const FDlgOnScheduledDialogueStarted& OnStarted, int32 RandomSeed = 0);
+
+	// Removes the request from the queue, its delegates are not called. Returns false if it is not in the queue anymore.
+	UFUNCTION(BlueprintCallable, Category = "Dialogue|Scheduler")
+	bool CancelScheduledDialogue(int32 RequestId);
+
+	UFUNCTION(BlueprintPure, Category = "Dialogue|Scheduler")
+	int32 GetNumScheduledDialogues() const { return Queue.Num(); }
+
+	// The context reused by UDlgManager::EvaluateBark, created on the first use
+	UDlgContext* GetBarkContext();
+
+protected:
+	void StartScheduledDialogue(const FDlgScheduledDialogue& Request);
+
+	// Heap order, the top is the highest priority scheduled first
+	static bool IsStartedBefore(const FDlgScheduledDialogue& A, const FDlgScheduledDialogue& B)
+	{
+		return A.Priority != B.Priority ? A.Priority > B.Priority : A.RequestId < B.RequestId;
+	}
+
+public:
+	// Called for every scheduled dialogue after it was started (or failed to start)
+	UPROPERTY(BlueprintAssignable, Category = "Dialogue|Scheduler")
+	FDlgOnScheduledDialogueStartedMulticast OnScheduledDialogueStarted;
+
+protected:
+	// Heap of the requests, see IsStartedBefore
+	TArray<FDlgScheduledDialogue> Queue;
+
+	int32 LastRequestId = 0;
+
+	// See GetBarkContext, released with the game instance
+	UPROPERTY(Transient)
+	UDlgContext* BarkContext = nullptr;
+};
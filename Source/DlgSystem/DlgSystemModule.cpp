@@ -27,6 +27,7 @@
 #include "GameplayDebugger/SDlgDataDisplay.h"
 #include "Logging/DlgLogger.h"
 #include "DlgHelper.h"
+#include "IO/DlgTextFileExporter.h"
 
 #define LOCTEXT_NAMESPACE "FDlgSystemModule"
 
@@ -91,6 +92,9 @@ void FDlgSystemModule::StartupModule()
 
 void FDlgSystemModule::ShutdownModule()
 {
+	// Finish writing the text files of the last saves
+	FDlgTextFileExporter::Get().Flush();
+
 	// Unregister the console commands in case the user forgot to clear them
 	UnregisterConsoleCommands();
 
@@ -315,6 +319,7 @@ void FDlgSystemModule::HandleDialogueRenamed(UDlgDialogue* RenamedDialogue, cons
 	{
 		const FString OldFileName = OldTextFilePathName + FileExtension;
 		const FString NewFileName = CurrentTextFilePathName + FileExtension;
+		FDlgTextFileExporter::Get().Flush(OldFileName);
 		FDlgHelper::RenameFile(OldFileName, NewFileName, true);
 	}
 }
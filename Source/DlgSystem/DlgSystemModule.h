@@ -4,6 +4,7 @@
 #include "IDlgSystemModule.h"
 #include "UObject/WeakObjectPtr.h"
 #include "UObject/WeakObjectPtrTemplates.h"
+#include "Engine/StreamableManager.h"
 
 class UDlgDialogue;
 class SWidget;
@@ -31,6 +32,7 @@ public:
 	TSharedRef<SWidget> GetDialogueDataDisplayWindow() override;
 	FTabSpawnerEntry* GetDialogueDataDisplaySpawnEntry() override;
 	void DisplayDialogueDataWindow() override;
+	FStreamableManager& GetStreamableManager() override { return StreamableManager; }
 
 private:
 	// Refreshes the actor of the DlgDataDisplay if it is already opened. Return true if refresh was successful
@@ -80,4 +82,7 @@ private:
 	FDelegateHandle OnInMemoryAssetDeletedHandle;
 	FDelegateHandle OnAssetRemovedHandle;
 	FDelegateHandle OnAssetRenamedHandle;
+
+	// Loads the node assets for all contexts
+	FStreamableManager StreamableManager;
 };
@@ -261,11 +261,39 @@ public:
 	UPROPERTY(Category = "Runtime", Config, EditAnywhere)
 	EDlgNoSatisfiedChildBehavior NoSatisfiedChildBehavior;
 
+	// If enabled the cooked Dialogues strip the data only the editor needs when they are loaded and shrink their node arrays
+	// NOTE: the participant names are kept, but the name queries of the UDlgManager (and the gameplay debugger) will not
+	// find the condition, event, variable names and speaker states of these Dialogues anymore
+	UPROPERTY(Category = "Runtime", Config, EditAnywhere)
+	bool bCompactCookedDialogues = false;
+
+	// If enabled the enter events of a node are collected first and called in one pass. The consecutive modifications of the same value
+	// of a participant are merged into a single call (the order of the events is kept) and UDlgContext::OnParticipantValuesChanged is broadcast once for each modified participant
+	UPROPERTY(Category = "Runtime", Config, EditAnywhere)
+	bool bDeferNodeEnterEvents = false;
+
+	// If enabled each game instance has its own dialogue history (see UDlgMemorySubsystem) instead of the single global one,
+	// so multiple PIE clients or worlds in the same process do not share it.
+	// NOTE: the history functions of the UDlgManager still use the global history (ClearDialogueHistory clears all of them),
+	// save and load the history of a game instance with the functions of its UDlgMemorySubsystem
+	UPROPERTY(Category = "Runtime", Config, EditAnywhere)
+	bool bDialogueHistoryPerGameInstance = false;
+
+	// Time in milliseconds the UDlgSchedulerSubsystem may spend each frame starting the queued dialogues.
+	// At least one queued dialogue is started each frame, even if it takes longer.
+	UPROPERTY(Category = "Runtime", Config, EditAnywhere, meta = (ClampMin = "0.0", UIMin = "0.0"))
+	float DialogueSchedulerBudgetMs = 1.f;
+
 
 	// The dialogue text format used for saving and reloading from text files.
 	UPROPERTY(Category = "Dialogue", Config, EditAnywhere, DisplayName = "Text Format")
 	EDlgDialogueTextFormat DialogueTextFormat = EDlgDialogueTextFormat::None;
 
+	// If enabled the text files are written on background tasks when the Dialogues are saved, files with unchanged contents are not written.
+	// The Dialogue is still serialized on the game thread. See FDlgTextFileExporter
+	UPROPERTY(Category = "Dialogue", Config, EditAnywhere, AdvancedDisplay)
+	bool bExportTextFilesAsync = true;
+
 	// What key combination to press to add a new line for FText fields in the Dialogue Editor.
 	UPROPERTY(Category = "Dialogue", Config, EditAnywhere, DisplayName = "Text Input Key for NewLine")
 	EDlgTextInputKeyForNewLine DialogueTextInputKeyForNewLine = EDlgTextInputKeyForNewLine::Enter;
@@ -296,6 +324,27 @@ public:
 	UPROPERTY(Category = "Dialogue Node Data", Config, EditAnywhere)
 	bool bShowGenericData = false;
 
+	// If true the voice and generic data of the speech nodes are saved as soft references, so loading a Dialogue does not load them.
+	// They are streamed asynchronously when their node becomes active and released after it is left.
+	// NOTE: The Dialogues are converted when they are saved.
+	// NOTE: The NodeData is an instanced object of the Dialogue, it is always a hard reference.
+	UPROPERTY(Category = "Dialogue Node Data", Config, EditAnywhere)
+	bool bUseSoftReferencesForNodeAssets = false;
+
+	// How many steps ahead of the active node are the soft referenced node assets prefetched, 0 disables the prefetching.
+	// The selectors and proxies do not count as a step.
+	UPROPERTY(Category = "Dialogue Node Data", Config, EditAnywhere, meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseSoftReferencesForNodeAssets"))
+	int32 PrefetchNodeAssetsDepth = 2;
+
+	// No new prefetches are started for a context once its prefetched assets take up this much memory (in MB)
+	UPROPERTY(Category = "Dialogue Node Data", Config, EditAnywhere, meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseSoftReferencesForNodeAssets"))
+	int32 PrefetchNodeAssetsBudgetMB = 32;
+
+	// How many prefetches of a context can be in flight at the same time.
+	// The size of an asset is only known once it is loaded, this keeps the pending loads from overshooting PrefetchNodeAssetsBudgetMB.
+	UPROPERTY(Category = "Dialogue Node Data", Config, EditAnywhere, meta = (ClampMin = "1", UIMin = "1", EditCondition = "bUseSoftReferencesForNodeAssets"))
+	int32 PrefetchNodeAssetsMaxPendingLoads = 4;
+
 	UPROPERTY(Category = "Dialogue Node Data", Config, EditAnywhere, AdvancedDisplay)
 	bool bShowAdvancedChildren = true;
 
@@ -367,6 +416,12 @@ public:
 	UPROPERTY(Category = "Localization", Config, EditAnywhere, AdvancedDisplay, DisplayName = "Remap Source Strings to Texts")
 	TMap<FString, FText> LocalizationRemapSourceStringsToTexts;
 
+	// The String Table the DlgInternEdgeTexts commandlet interns the edge texts into. Identical source strings in the same namespace share
+	// a single entry (keyed by the namespace and the hash of the source string), so they are stored and gathered for localization only once.
+	// NOTE: the commandlet saves the String Table together with the Dialogues, the existing translations of the edge texts are not moved into it
+	UPROPERTY(Category = "Localization", Config, EditAnywhere, AdvancedDisplay, DisplayName = "Edge Texts String Table", meta = (AllowedClasses = "StringTable"))
+	FSoftObjectPath EdgeTextsStringTable;
+
 
 	// Enables the message log to output info/errors/warnings to it
 	UPROPERTY(Category = "Logger", Config, EditAnywhere)
@@ -403,6 +458,11 @@ public:
 	UPROPERTY(Category = "Browser", Config, EditAnywhere)
 	bool bHideEmptyDialogueBrowserCategories = true;
 
+	// How often (in seconds) the Dialogue Data Display reads the values of the participants.
+	// All the displayed values are read together in one batch, 0 means every frame.
+	UPROPERTY(Category = "Data Display", Config, EditAnywhere, meta = (ClampMin = "0.0", UIMin = "0.0"))
+	float DataDisplaySampleIntervalSeconds = 1.f;
+
 
 	//
 	// External URLs
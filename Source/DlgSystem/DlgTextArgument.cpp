@@ -6,12 +6,17 @@
 #include "DlgConstants.h"
 #include "DlgContext.h"
 #include "DlgHelper.h"
-#include "DlgDialogueParticipant.h"
+#include "DlgTrace.h"
+#include "DlgParticipantCaller.h"
 #include "NYReflectionHelper.h"
 #include "Logging/DlgLogger.h"
 
 FFormatArgumentValue FDlgTextArgument::ConstructFormatArgumentValue(const UDlgContext& Context, FName NodeOwner) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_DlgTextArgument);
+	INC_DWORD_STAT(STAT_DlgNumTextArguments);
+	DLG_TRACE_SCOPE(TEXT("TextArgument"), ArgumentTypeToString(Type), Context);
+
 	// If participant name is not valid we use the node owner name
 	const FName ValidParticipantName = ParticipantName == NAME_None ? NodeOwner : ParticipantName;
 	const UObject* Participant = Context.GetParticipant(ValidParticipantName);
@@ -27,13 +32,13 @@ FFormatArgumentValue FDlgTextArgument::ConstructFormatArgumentValue(const UDlgCo
 	switch (Type)
 	{
 		case EDlgTextArgumentType::DialogueInt:
-			return FFormatArgumentValue(IDlgDialogueParticipant::Execute_GetIntValue(Participant, VariableName));
+			return FFormatArgumentValue(FDlgParticipantCaller::GetIntValue(Participant, VariableName));
 
 		case EDlgTextArgumentType::ClassInt:
 			return FFormatArgumentValue(FNYReflectionHelper::GetVariable<FIntProperty, int32>(Participant, VariableName));
 
 		case EDlgTextArgumentType::DialogueFloat:
-			return FFormatArgumentValue(IDlgDialogueParticipant::Execute_GetFloatValue(Participant, VariableName));
+			return FFormatArgumentValue(FDlgParticipantCaller::GetFloatValue(Participant, VariableName));
 
 		case EDlgTextArgumentType::ClassFloat:
 			return FFormatArgumentValue(FNYReflectionHelper::GetVariable<FDoubleProperty, double>(Participant, VariableName));
@@ -42,10 +47,10 @@ FFormatArgumentValue FDlgTextArgument::ConstructFormatArgumentValue(const UDlgCo
 			return FFormatArgumentValue(FNYReflectionHelper::GetVariable<FTextProperty, FText>(Participant, VariableName));
 
 		case EDlgTextArgumentType::DisplayName:
-			return FFormatArgumentValue(IDlgDialogueParticipant::Execute_GetParticipantDisplayName(Participant, NodeOwner));
+			return FFormatArgumentValue(FDlgParticipantCaller::GetParticipantDisplayName(Participant, NodeOwner));
 
 		case EDlgTextArgumentType::Gender:
-			return FFormatArgumentValue(IDlgDialogueParticipant::Execute_GetParticipantGender(Participant));
+			return FFormatArgumentValue(FDlgParticipantCaller::GetParticipantGender(Participant));
 
 		case EDlgTextArgumentType::Custom:
 			if (CustomTextArgument == nullptr)
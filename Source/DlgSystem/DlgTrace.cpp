@@ -0,0 +1,35 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgTrace.h"
+
+#include "DlgContext.h"
+#include "DlgDialogue.h"
+
+DEFINE_STAT(STAT_DlgNodeEnter);
+DEFINE_STAT(STAT_DlgReevaluateOptions);
+DEFINE_STAT(STAT_DlgCondition);
+DEFINE_STAT(STAT_DlgEvent);
+DEFINE_STAT(STAT_DlgTextArgument);
+DEFINE_STAT(STAT_DlgParticipantLookup);
+
+DEFINE_STAT(STAT_DlgNumNodesEntered);
+DEFINE_STAT(STAT_DlgNumConditions);
+DEFINE_STAT(STAT_DlgNumEvents);
+DEFINE_STAT(STAT_DlgNumTextArguments);
+
+#if NY_ENGINE_VERSION >= 500
+UE_TRACE_CHANNEL_DEFINE(DlgSystemChannel);
+#endif
+
+FString FDlgTrace::MakeScopeName(const TCHAR* Name, const UDlgContext& Context)
+{
+	const UDlgDialogue* Dialogue = Context.GetDialogue();
+	return FString::Printf(
+		TEXT("%s [%s, Node %d]"),
+		Name, Dialogue ? *Dialogue->GetDialogueName() : TEXT("INVALID"), Context.GetActiveNodeIndex()
+	);
+}
+
+FString FDlgTrace::MakeScopeName(const TCHAR* Name, const FString& Type, const UDlgContext& Context)
+{
+	return MakeScopeName(*FString::Printf(TEXT("%s %s"), Name, *Type), Context);
+}
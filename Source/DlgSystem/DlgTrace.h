@@ -0,0 +1,57 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+#include "NYEngineVersionHelpers.h"
+
+#if NY_ENGINE_VERSION >= 500
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#endif
+
+class UDlgContext;
+
+// stat DlgSystem
+DECLARE_STATS_GROUP(TEXT("DlgSystem"), STATGROUP_DlgSystem, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Node Enter"), STAT_DlgNodeEnter, STATGROUP_DlgSystem, DLGSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Reevaluate Options"), STAT_DlgReevaluateOptions, STATGROUP_DlgSystem, DLGSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Condition"), STAT_DlgCondition, STATGROUP_DlgSystem, DLGSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Event"), STAT_DlgEvent, STATGROUP_DlgSystem, DLGSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Text Argument"), STAT_DlgTextArgument, STATGROUP_DlgSystem, DLGSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Participant Lookup"), STAT_DlgParticipantLookup, STATGROUP_DlgSystem, DLGSYSTEM_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Nodes Entered"), STAT_DlgNumNodesEntered, STATGROUP_DlgSystem, DLGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Conditions Evaluated"), STAT_DlgNumConditions, STATGROUP_DlgSystem, DLGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Events Called"), STAT_DlgNumEvents, STATGROUP_DlgSystem, DLGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Text Arguments Constructed"), STAT_DlgNumTextArguments, STATGROUP_DlgSystem, DLGSYSTEM_API);
+
+#if NY_ENGINE_VERSION >= 500
+// Trace channel of the dialogue runtime, enable it with -trace=cpu,DlgSystem
+UE_TRACE_CHANNEL_EXTERN(DlgSystemChannel, DLGSYSTEM_API);
+#endif
+
+class DLGSYSTEM_API FDlgTrace
+{
+public:
+	// Name of a trace scope tagged with the dialogue and active node of the Context. Eg: "Condition EventCall [MyDialogue, Node 3]"
+	static FString MakeScopeName(const TCHAR* Name, const UDlgContext& Context);
+	static FString MakeScopeName(const TCHAR* Name, const FString& Type, const UDlgContext& Context);
+};
+
+#if NY_ENGINE_VERSION >= 500
+	// Dynamically named trace scope on the DlgSystem channel, the name is only built while the channel is enabled
+	#define DLG_TRACE_SCOPE(...) \
+		TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL( \
+			UE_TRACE_CHANNELEXPR_IS_ENABLED(DlgSystemChannel) ? *FDlgTrace::MakeScopeName(__VA_ARGS__) : TEXT(""), \
+			DlgSystemChannel \
+		)
+
+	// Statically named trace scope on the DlgSystem channel, for the scopes too cheap to be tagged
+	#define DLG_TRACE_SCOPE_STATIC(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, DlgSystemChannel)
+#else
+	#define DLG_TRACE_SCOPE(...)
+	#define DLG_TRACE_SCOPE_STATIC(Name)
+#endif
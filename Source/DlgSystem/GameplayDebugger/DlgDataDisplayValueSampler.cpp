@@ -0,0 +1,186 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgDataDisplayValueSampler.h"
+
+#include "HAL/PlatformTime.h"
+#include "UObject/TextProperty.h"
+
+#include "DlgSystem/DlgDialogueParticipant.h"
+#include "DlgSystem/DlgSystemSettings.h"
+#include "DlgSystem/NYReflectionHelper.h"
+
+#define LOCTEXT_NAMESPACE "DlgDataDisplayValueSampler"
+
+static FString BoolToFString(const bool Value)
+{
+	return Value ? TEXT("True") : TEXT("False");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgDataDisplayValueSampler
+void FDlgDataDisplayValueSampler::Register(
+	const TSharedPtr<FDlgDataDisplayTreeVariableNode>& VariableNode,
+	const FSimpleDelegate& OnValueChanged
+)
+{
+	if (!VariableNode.IsValid())
+	{
+		return;
+	}
+
+	FEntry Entry;
+	Entry.VariableNode = VariableNode;
+	Entry.OnValueChanged = OnValueChanged;
+	Entries.Add(MoveTemp(Entry));
+}
+
+void FDlgDataDisplayValueSampler::Tick(float DeltaTime)
+{
+	// We only sample after the interval has passed
+	PassedDeltaTimeSeconds += DeltaTime;
+	if (PassedDeltaTimeSeconds < GetDefault<UDlgSystemSettings>()->DataDisplaySampleIntervalSeconds)
+	{
+		return;
+	}
+
+	PassedDeltaTimeSeconds = 0.f;
+	SampleAll();
+}
+
+void FDlgDataDisplayValueSampler::SampleAll()
+{
+	const double StartTimeSeconds = FPlatformTime::Seconds();
+	LastNumSampled = 0;
+	LastNumChanged = 0;
+
+	for (int32 Index = Entries.Num() - 1; Index >= 0; Index--)
+	{
+		// Widget or node is gone
+		const TSharedPtr<FDlgDataDisplayTreeVariableNode> VariableNode = Entries[Index].VariableNode.Pin();
+		if (!VariableNode.IsValid() || !Entries[Index].OnValueChanged.IsBound())
+		{
+			Entries.RemoveAtSwap(Index);
+			continue;
+		}
+
+		LastNumSampled++;
+		if (SampleVariableNode(*VariableNode))
+		{
+			// Only push the changed values to the widgets
+			LastNumChanged++;
+			Entries[Index].OnValueChanged.Execute();
+		}
+	}
+
+	LastSampleTimeSeconds = FPlatformTime::Seconds() - StartTimeSeconds;
+}
+
+bool FDlgDataDisplayValueSampler::SampleVariableNode(FDlgDataDisplayTreeVariableNode& VariableNode)
+{
+	TWeakObjectPtr<const AActor> Actor = VariableNode.GetParentActor();
+	if (!Actor.IsValid())
+	{
+		return false;
+	}
+
+	FString NewValue;
+	const FName VariableName = VariableNode.GetVariableName();
+	switch (VariableNode.GetVariableType())
+	{
+		case EDlgDataDisplayVariableTreeNodeType::Integer:
+		{
+			const int32 Value = IDlgDialogueParticipant::Execute_GetIntValue(Actor.Get(), VariableName);
+			NewValue = FString::FromInt(Value);
+			break;
+		}
+		case EDlgDataDisplayVariableTreeNodeType::Float:
+		{
+			const float Value = IDlgDialogueParticipant::Execute_GetFloatValue(Actor.Get(), VariableName);
+			NewValue = FString::SanitizeFloat(Value);
+			break;
+		}
+		case EDlgDataDisplayVariableTreeNodeType::Bool:
+		{
+			const bool Value = IDlgDialogueParticipant::Execute_GetBoolValue(Actor.Get(), VariableName);
+			NewValue = BoolToFString(Value);
+			break;
+		}
+		case EDlgDataDisplayVariableTreeNodeType::FName:
+		{
+			const FName Value = IDlgDialogueParticipant::Execute_GetNameValue(Actor.Get(), VariableName);
+			NewValue = Value.ToString();
+			break;
+		}
+
+		case EDlgDataDisplayVariableTreeNodeType::ClassInteger:
+		{
+			const int32 Value = FNYReflectionHelper::GetVariable<FIntProperty, int32>(Actor.Get(), VariableName);
+			NewValue = FString::FromInt(Value);
+			break;
+		}
+		case EDlgDataDisplayVariableTreeNodeType::ClassFloat:
+		{
+			const double Value = FNYReflectionHelper::GetVariable<FDoubleProperty, double>(Actor.Get(), VariableName);
+			NewValue = FString::SanitizeFloat(Value);
+			break;
+		}
+		case EDlgDataDisplayVariableTreeNodeType::ClassBool:
+		{
+			const bool Value = FNYReflectionHelper::GetVariable<FBoolProperty, bool>(Actor.Get(), VariableName);
+			NewValue = BoolToFString(Value);
+			break;
+		}
+		case EDlgDataDisplayVariableTreeNodeType::ClassFName:
+		{
+			const FName Value = FNYReflectionHelper::GetVariable<FNameProperty, FName>(Actor.Get(), VariableName);
+			NewValue = Value.ToString();
+			break;
+		}
+		case EDlgDataDisplayVariableTreeNodeType::ClassFText:
+		{
+			const FText Value = FNYReflectionHelper::GetVariable<FTextProperty, FText>(Actor.Get(), VariableName);
+			NewValue = Value.ToString();
+			break;
+		}
+
+		case EDlgDataDisplayVariableTreeNodeType::Event:
+		case EDlgDataDisplayVariableTreeNodeType::UnrealFunction:
+		{
+			// Event does not have any state value, ignore
+			return false;
+		}
+		case EDlgDataDisplayVariableTreeNodeType::Condition:
+		{
+			const bool Value = IDlgDialogueParticipant::Execute_CheckCondition(Actor.Get(), nullptr, VariableName);
+			NewValue = BoolToFString(Value);
+			break;
+		}
+		case EDlgDataDisplayVariableTreeNodeType::Default:
+		default:
+			NewValue = TEXT("UNIMPLEMENTED - SHOULD NEVER HAPPEN");
+			break;
+	}
+
+	if (NewValue.Equals(VariableNode.GetVariableValue(), ESearchCase::CaseSensitive))
+	{
+		return false;
+	}
+
+	VariableNode.SetVariableValue(NewValue);
+	return true;
+}
+
+FText FDlgDataDisplayValueSampler::GetStatsText() const
+{
+	FNumberFormattingOptions TimeFormat;
+	TimeFormat.MinimumFractionalDigits = 3;
+	TimeFormat.MaximumFractionalDigits = 3;
+
+	return FText::Format(
+		LOCTEXT("SamplerStatsText", "Sampled {0} values ({1} changed) in {2} ms"),
+		FText::AsNumber(LastNumSampled),
+		FText::AsNumber(LastNumChanged),
+		FText::AsNumber(GetLastSampleTimeMs(), &TimeFormat)
+	);
+}
+
+#undef LOCTEXT_NAMESPACE
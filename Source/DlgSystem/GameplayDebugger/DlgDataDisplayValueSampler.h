@@ -0,0 +1,56 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "DlgDataDisplayTreeNode.h"
+
+/**
+ * Reads the values of all the displayed variables of the Data Display in one batch.
+ * The widgets register here instead of each reading its own value, they are only notified when their value changed.
+ */
+class DLGSYSTEM_API FDlgDataDisplayValueSampler
+{
+	typedef FDlgDataDisplayValueSampler Self;
+
+public:
+	// Registers the VariableNode, OnValueChanged is called each time a sample changes the value of the VariableNode.
+	void Register(const TSharedPtr<FDlgDataDisplayTreeVariableNode>& VariableNode, const FSimpleDelegate& OnValueChanged);
+
+	// Advances the timer, samples everything after UDlgSystemSettings::DataDisplaySampleIntervalSeconds has passed.
+	void Tick(float DeltaTime);
+
+	// Samples all the registered variables right now.
+	void SampleAll();
+
+	// Reads the value of the VariableNode from its Actor
+	// @return true if the value changed
+	static bool SampleVariableNode(FDlgDataDisplayTreeVariableNode& VariableNode);
+
+	// Stats of the last batch
+	int32 GetNumRegistered() const { return Entries.Num(); }
+	int32 GetLastNumSampled() const { return LastNumSampled; }
+	int32 GetLastNumChanged() const { return LastNumChanged; }
+	double GetLastSampleTimeMs() const { return LastSampleTimeSeconds * 1000.0; }
+
+	// Human readable stats of the sampler, including its own cost
+	FText GetStatsText() const;
+
+protected:
+	struct FEntry
+	{
+		TWeakPtr<FDlgDataDisplayTreeVariableNode> VariableNode;
+		FSimpleDelegate OnValueChanged;
+	};
+
+	// All the registered variables, the stale ones are removed on the next sample
+	TArray<FEntry> Entries;
+
+	// Number of seconds passed since the last sample
+	float PassedDeltaTimeSeconds = 0.f;
+
+	// Stats of the last batch
+	int32 LastNumSampled = 0;
+	int32 LastNumChanged = 0;
+	double LastSampleTimeSeconds = 0.0;
+};
@@ -2,26 +2,99 @@
 #if WITH_GAMEPLAY_DEBUGGER
 #include "DlgGameplayDebuggerCategory.h"
 
-#include "DlgSystem/DlgManager.h"
+#include "HAL/PlatformTime.h"
+
+#include "DlgSystem/DlgContext.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/DlgMemory.h"
+#include "DlgSystem/DlgRuntimeStats.h"
 
 FDlgGameplayDebuggerCategory::FDlgGameplayDebuggerCategory()
 {
 	bShowOnlyWithDebugActor = false;
 }
 
+FDlgGameplayDebuggerCategory::~FDlgGameplayDebuggerCategory()
+{
+	FDlgRuntimeStats::Get().SetEnabled(false);
+}
+
+void FDlgGameplayDebuggerCategory::OnGameplayDebuggerDeactivated()
+{
+	// Enabled again by the next CollectData of any active category
+	FDlgRuntimeStats::Get().SetEnabled(false);
+}
+
 void FDlgGameplayDebuggerCategory::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
 {
-	Data.NumLoadedDialogues = UDlgManager::GetAllDialoguesFromMemory().Num();
+	// Everything here is read from the counters maintained by the runtime, nothing is scanned
+	FDlgRuntimeStats& Stats = FDlgRuntimeStats::Get();
+	Stats.SetEnabled(true);
+	const FDlgRuntimeStats& ConstStats = Stats;
+
+	Data.NumLoadedDialogues = Stats.GetNumLoadedDialogues();
+
+	Data.ActiveContexts.Empty();
+	for (const UDlgContext* Context : Stats.GetActiveContexts())
+	{
+		const UDlgDialogue* Dialogue = Context->GetDialogue();
+		Data.ActiveContexts.Emplace(Dialogue ? Dialogue->GetDialogueName() : FString(), Context->GetActiveNodeIndex());
+	}
 
-	if (DebugActor)
+	const double NowSeconds = FPlatformTime::Seconds();
+	const int64 NumConditionEvaluations = Stats.GetNumConditionEvaluations();
+	if (LastCollectTimeSeconds > 0.0 && NowSeconds > LastCollectTimeSeconds)
 	{
+		Data.ConditionEvaluationsPerSecond =
+			static_cast<double>(NumConditionEvaluations - LastNumConditionEvaluations) / (NowSeconds - LastCollectTimeSeconds);
+	}
+	LastNumConditionEvaluations = NumConditionEvaluations;
+	LastCollectTimeSeconds = NowSeconds;
+
+	const FDlgRuntimeTimingStats& ReevaluateOptionsStats = ConstStats.GetReevaluateOptionsStats();
+	Data.NumReevaluateOptions = ReevaluateOptionsStats.Num;
+	Data.ReevaluateOptionsAverageMs = ReevaluateOptionsStats.GetAverageMs();
+	Data.ReevaluateOptionsPeakMs = ReevaluateOptionsStats.GetPeakMs();
+
+	const FDlgRuntimeTimingStats& TextFormatStats = ConstStats.GetTextFormatStats();
+	Data.NumTextFormats = TextFormatStats.Num;
+	Data.TextFormatTotalMs = TextFormatStats.GetTotalMs();
+	Data.TextFormatAverageMs = TextFormatStats.GetAverageMs();
 
+	Data.MemoryAllocatedSize = FDlgMemory::Get(OwnerPC).GetAllocatedSize();
+
+	Data.MostExpensiveConditions.Empty();
+	for (const auto& Elem : Stats.GetMostExpensiveConditions(NumMostExpensiveConditions))
+	{
+		Data.MostExpensiveConditions.Emplace(Elem.Key, Elem.Value.GetTotalMs());
 	}
 }
 
 void FDlgGameplayDebuggerCategory::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
 {
-	CanvasContext.Printf(TEXT("{green}Number loaded Dialogues: %s"), *FString::FromInt(Data.NumLoadedDialogues));
+	CanvasContext.Printf(TEXT("{green}Number loaded Dialogues: {white}%d"), Data.NumLoadedDialogues);
+	CanvasContext.Printf(TEXT("{green}Number active Dialogues: {white}%d"), Data.ActiveContexts.Num());
+	for (const auto& Elem : Data.ActiveContexts)
+	{
+		CanvasContext.Printf(TEXT("    {white}%s {green}active node: {white}%d"), *Elem.Key, Elem.Value);
+	}
+
+	CanvasContext.Printf(TEXT("{green}Condition evaluations per second: {white}%.1f"), Data.ConditionEvaluationsPerSecond);
+	CanvasContext.Printf(
+		TEXT("{green}ReevaluateOptions: {white}%lld {green}calls, average {white}%.4f ms{green}, peak {white}%.4f ms"),
+		Data.NumReevaluateOptions, Data.ReevaluateOptionsAverageMs, Data.ReevaluateOptionsPeakMs
+	);
+	CanvasContext.Printf(
+		TEXT("{green}Text format: {white}%lld {green}calls, total {white}%.4f ms{green}, average {white}%.4f ms"),
+		Data.NumTextFormats, Data.TextFormatTotalMs, Data.TextFormatAverageMs
+	);
+	CanvasContext.Printf(TEXT("{green}Dialogue memory size: {white}%.2f KB"), static_cast<double>(Data.MemoryAllocatedSize) / 1024.0);
+
+	CanvasContext.Printf(TEXT("{green}Most expensive conditions:"));
+	for (const auto& Elem : Data.MostExpensiveConditions)
+	{
+		CanvasContext.Printf(TEXT("    {white}%s {green}total {white}%.4f ms"), *Elem.Key.ToString(), Elem.Value);
+	}
 }
 
 #endif // WITH_GAMEPLAY_DEBUGGER
@@ -13,6 +13,24 @@ class FGameplayDebuggerCanvasContext;
 struct DLGSYSTEM_API FDlgDataToPrint
 {
 	int32 NumLoadedDialogues = 0;
+
+	// Dialogue name and active node index of each active context
+	TArray<TPair<FString, int32>> ActiveContexts;
+
+	double ConditionEvaluationsPerSecond = 0.0;
+
+	int64 NumReevaluateOptions = 0;
+	double ReevaluateOptionsAverageMs = 0.0;
+	double ReevaluateOptionsPeakMs = 0.0;
+
+	int64 NumTextFormats = 0;
+	double TextFormatTotalMs = 0.0;
+	double TextFormatAverageMs = 0.0;
+
+	SIZE_T MemoryAllocatedSize = 0;
+
+	// Name and total time of the most expensive conditions
+	TArray<TPair<FName, double>> MostExpensiveConditions;
 };
 
 class DLGSYSTEM_API FDlgGameplayDebuggerCategory : public FGameplayDebuggerCategory
@@ -22,6 +40,7 @@ private:
 
 public:
 	FDlgGameplayDebuggerCategory();
+	~FDlgGameplayDebuggerCategory();
 
 	/** Creates an instance of this category - will be used on module startup to include our category in the Editor */
 	static TSharedRef<FGameplayDebuggerCategory> MakeInstance() { return MakeShared<Self>(); }
@@ -34,9 +53,19 @@ public:
 	/** Displays the data we collected in the CollectData function */
 	void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
 
+	/** Stops measuring the timings, they are only measured while the data is collected */
+	void OnGameplayDebuggerDeactivated() override;
+
 protected:
 	// The data that we're going to print
 	FDlgDataToPrint Data;
+
+	// Used to compute the condition evaluations per second between two collects
+	int64 LastNumConditionEvaluations = 0;
+	double LastCollectTimeSeconds = 0.0;
+
+	// How many of the most expensive conditions we display
+	static constexpr int32 NumMostExpensiveConditions = 5;
 };
 
 #endif // WITH_GAMEPLAY_DEBUGGER
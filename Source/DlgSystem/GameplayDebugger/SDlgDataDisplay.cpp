@@ -29,6 +29,7 @@ DEFINE_LOG_CATEGORY(LogDlgSystemDataDisplay)
 void SDlgDataDisplay::Construct(const FArguments& InArgs, const TWeakObjectPtr<const UObject>& InWorldContextObjectPtr)
 {
 	WorldContextObjectPtr = InWorldContextObjectPtr;
+	ValueSampler = MakeShared<FDlgDataDisplayValueSampler>();
 	RootTreeItem = MakeShared<FDlgDataDisplayTreeRootNode>();
 	ActorsTreeView = SNew(STreeView<TSharedPtr<FDlgDataDisplayTreeNode>>)
 		// .ItemHeight(32)
@@ -69,6 +70,17 @@ void SDlgDataDisplay::Construct(const FArguments& InArgs, const TWeakObjectPtr<c
 					GetFilterTextBoxWidget()
 				]
 
+				// Cost of reading the values
+				+SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(0.f, 0.f, 4.f, 0.f)
+				[
+					SNew(STextBlock)
+					.ToolTipText(LOCTEXT("SamplerStatsToolTip", "How many values were read from the Actors in the last update and how long it took."))
+					.Text(this, &Self::GetValueSamplerStatsText)
+				]
+
 				// Refresh Actors
 				+SHorizontalBox::Slot()
 				.AutoWidth()
@@ -101,6 +113,12 @@ void SDlgDataDisplay::Construct(const FArguments& InArgs, const TWeakObjectPtr<c
 	RefreshTree(false);
 }
 
+void SDlgDataDisplay::Tick(const FGeometry& AllottedGeometry, double InCurrentTime, float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+	ValueSampler->Tick(InDeltaTime);
+}
+
 void SDlgDataDisplay::RefreshTree(bool bPreserveExpansion)
 {
 	// First, save off current expansion state
@@ -543,7 +561,7 @@ TSharedRef<ITableRow> SDlgDataDisplay::HandleGenerateRow(TSharedPtr<FDlgDataDisp
 				case EDlgDataDisplayVariableTreeNodeType::ClassFName:
 				case EDlgDataDisplayVariableTreeNodeType::ClassFText:
 					// Editable text box
-					SAssignNew(RightWidget, SDlgDataTextPropertyValue, VariableNode);
+					SAssignNew(RightWidget, SDlgDataTextPropertyValue, VariableNode, ValueSampler);
 					break;
 
 				case EDlgDataDisplayVariableTreeNodeType::Event:
@@ -556,13 +574,13 @@ TSharedRef<ITableRow> SDlgDataDisplay::HandleGenerateRow(TSharedPtr<FDlgDataDisp
 				case EDlgDataDisplayVariableTreeNodeType::ClassBool:
 				case EDlgDataDisplayVariableTreeNodeType::Condition:
 					// Checkbox
-					SAssignNew(RightWidget, SDlgDataBoolPropertyValue, VariableNode);
+					SAssignNew(RightWidget, SDlgDataBoolPropertyValue, VariableNode, ValueSampler);
 					break;
 
 				case EDlgDataDisplayVariableTreeNodeType::Default:
 				default:
 					// Static text
-					SAssignNew(RightWidget, SDlgDataPropertyValue, VariableNode);
+					SAssignNew(RightWidget, SDlgDataPropertyValue, VariableNode, ValueSampler);
 					break;
 			}
 
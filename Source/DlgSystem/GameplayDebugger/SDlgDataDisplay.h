@@ -7,6 +7,7 @@
 
 #include "DlgDataDisplayTreeNode.h"
 #include "DlgDataDisplayActorProperties.h"
+#include "DlgDataDisplayValueSampler.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogDlgSystemDataDisplay, Verbose, All);
 
@@ -32,7 +33,13 @@ public:
 	// Get current filter text
 	FText GetFilterText() const { return FilterTextBoxWidget->GetText(); }
 
+	// SWidget Interface
+	void Tick(const FGeometry& AllottedGeometry, double InCurrentTime, float InDeltaTime) override;
+
 private:
+	// The stats of the value sampler, displayed in the top bar
+	FText GetValueSamplerStatsText() const { return ValueSampler->GetStatsText(); }
+
 	// Handle filtering.
 	void GenerateFilteredItems();
 
@@ -106,6 +113,9 @@ private:
 	// Value: Actor properties
 	TMap<TWeakObjectPtr<AActor>, TSharedPtr<FDlgDataDisplayActorProperties>> ActorsProperties;
 
+	// Reads the values of all the displayed variables in one batch
+	TSharedPtr<FDlgDataDisplayValueSampler> ValueSampler;
+
 	// Reference Object used to get the World
 	TWeakObjectPtr<const UObject> WorldContextObjectPtr = nullptr;
 };
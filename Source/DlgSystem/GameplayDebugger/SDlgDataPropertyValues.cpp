@@ -25,11 +25,6 @@ static FText ValidateNameLength(const FText& Text)
 	return FText::GetEmpty();
 }
 
-static FString BoolToFString(const bool Value)
-{
-	return Value ? TEXT("True") : TEXT("False");
-}
-
 static bool FStringToBool(const FString& Value)
 {
 	return FCString::ToBool(*Value);
@@ -37,7 +32,11 @@ static bool FStringToBool(const FString& Value)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // SDlgDataProperty
-void SDlgDataPropertyValue::Construct(const FArguments& InArgs, const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode)
+void SDlgDataPropertyValue::Construct(
+	const FArguments& InArgs,
+	const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode,
+	const TSharedPtr<FDlgDataDisplayValueSampler>& InValueSampler
+)
 {
 	VariableNode = InVariableNode;
 	if (!VariableNode.IsValid())
@@ -46,124 +45,47 @@ void SDlgDataPropertyValue::Construct(const FArguments& InArgs, const TSharedPtr
 	}
 
 	UpdateVariableNodeFromActor();
+	RegisterToValueSampler(InValueSampler);
 
 	ChildSlot
 	[
-		SNew(STextBlock)
-		.Text(this, &Self::GetTextValue)
+		SAssignNew(TextBlockWidget, STextBlock)
+		.Text(GetTextValue())
 	];
 }
 
-void SDlgDataPropertyValue::Tick(const FGeometry& AllottedGeometry, double InCurrentTime, float InDeltaTime)
+void SDlgDataPropertyValue::UpdateVariableNodeFromActor()
 {
-	Super::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
-
-	// We only run this Tick only after TickUpdateTimeSeconds has passed
-	TickPassedDeltaTimeSeconds += InDeltaTime;
-	if (TickPassedDeltaTimeSeconds < TickUpdateTimeSeconds)
+	if (VariableNode.IsValid() && FDlgDataDisplayValueSampler::SampleVariableNode(*VariableNode))
 	{
-		return;
+		HandleVariableValueChanged();
 	}
-
-	// Update the value
-	TickPassedDeltaTimeSeconds = 0.f;
-	UpdateVariableNodeFromActor();
 }
 
-void SDlgDataPropertyValue::UpdateVariableNodeFromActor()
+void SDlgDataPropertyValue::RegisterToValueSampler(const TSharedPtr<FDlgDataDisplayValueSampler>& InValueSampler)
 {
-	if (!VariableNode.IsValid())
-	{
-		return;
-	}
-
-	TWeakObjectPtr<const AActor> Actor = VariableNode->GetParentActor();
-	if (!Actor.IsValid())
+	if (InValueSampler.IsValid())
 	{
-		return;
+		InValueSampler->Register(VariableNode, FSimpleDelegate::CreateSP(this, &Self::HandleVariableValueChanged));
 	}
+}
 
-	const FName VariableName = VariableNode->GetVariableName();
-	switch (VariableNode->GetVariableType())
+void SDlgDataPropertyValue::HandleVariableValueChanged()
+{
+	if (TextBlockWidget.IsValid())
 	{
-		case EDlgDataDisplayVariableTreeNodeType::Integer:
-		{
-			const int32 Value = IDlgDialogueParticipant::Execute_GetIntValue(Actor.Get(), VariableName);
-			VariableNode->SetVariableValue(FString::FromInt(Value));
-			break;
-		}
-		case EDlgDataDisplayVariableTreeNodeType::Float:
-		{
-			const float Value = IDlgDialogueParticipant::Execute_GetFloatValue(Actor.Get(), VariableName);
-			VariableNode->SetVariableValue(FString::SanitizeFloat(Value));
-			break;
-		}
-		case EDlgDataDisplayVariableTreeNodeType::Bool:
-		{
-			const bool Value = IDlgDialogueParticipant::Execute_GetBoolValue(Actor.Get(), VariableName);
-			VariableNode->SetVariableValue(BoolToFString(Value));
-			break;
-		}
-		case EDlgDataDisplayVariableTreeNodeType::FName:
-		{
-			const FName Value = IDlgDialogueParticipant::Execute_GetNameValue(Actor.Get(), VariableName);
-			VariableNode->SetVariableValue(Value.ToString());
-			break;
-		}
-
-		case EDlgDataDisplayVariableTreeNodeType::ClassInteger:
-		{
-			const int32 Value = FNYReflectionHelper::GetVariable<FIntProperty, int32>(Actor.Get(), VariableName);
-			VariableNode->SetVariableValue(FString::FromInt(Value));
-			break;
-		}
-		case EDlgDataDisplayVariableTreeNodeType::ClassFloat:
-		{
-			const double Value = FNYReflectionHelper::GetVariable<FDoubleProperty, double>(Actor.Get(), VariableName);
-			VariableNode->SetVariableValue(FString::SanitizeFloat(Value));
-			break;
-		}
-		{
-		case EDlgDataDisplayVariableTreeNodeType::ClassBool:
-			const bool Value = FNYReflectionHelper::GetVariable<FBoolProperty, bool>(Actor.Get(), VariableName);
-			VariableNode->SetVariableValue(BoolToFString(Value));
-			break;
-		}
-		case EDlgDataDisplayVariableTreeNodeType::ClassFName:
-		{
-			const FName Value = FNYReflectionHelper::GetVariable<FNameProperty, FName>(Actor.Get(), VariableName);
-			VariableNode->SetVariableValue(Value.ToString());
-			break;
-		}
-		case EDlgDataDisplayVariableTreeNodeType::ClassFText:
-		{
-			const FText Value = FNYReflectionHelper::GetVariable<FTextProperty, FText>(Actor.Get(), VariableName);
-			VariableNode->SetVariableValue(Value.ToString());
-			break;
-		}
-
-		case EDlgDataDisplayVariableTreeNodeType::Event:
-		case EDlgDataDisplayVariableTreeNodeType::UnrealFunction:
-		{
-			// Event does not have any state value, ignore
-			break;
-		}
-		case EDlgDataDisplayVariableTreeNodeType::Condition:
-		{
-			const bool Value = IDlgDialogueParticipant::Execute_CheckCondition(Actor.Get(), nullptr, VariableName);
-			VariableNode->SetVariableValue(BoolToFString(Value));
-			break;
-		}
-		case EDlgDataDisplayVariableTreeNodeType::Default:
-		default:
-			VariableNode->SetVariableValue(TEXT("UNIMPLEMENTED - SHOULD NEVER HAPPEN"));
+		TextBlockWidget->SetText(GetTextValue());
 	}
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // SDlgDataTextPropertyValue
-void SDlgDataTextPropertyValue::Construct(const FArguments& InArgs, const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode)
+void SDlgDataTextPropertyValue::Construct(
+	const FArguments& InArgs,
+	const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode,
+	const TSharedPtr<FDlgDataDisplayValueSampler>& InValueSampler
+)
 {
 	VariableNode = InVariableNode;
 	if (!VariableNode.IsValid())
@@ -172,6 +94,8 @@ void SDlgDataTextPropertyValue::Construct(const FArguments& InArgs, const TShare
 	}
 
 	UpdateVariableNodeFromActor();
+	RegisterToValueSampler(InValueSampler);
+	DisplayedText = GetTextValue();
 	bIsFNameProperty = VariableNode->GetVariableType() == EDlgDataDisplayVariableTreeNodeType::FName;
 
 	ChildSlot
@@ -181,7 +105,7 @@ void SDlgDataTextPropertyValue::Construct(const FArguments& InArgs, const TShare
 		.FillWidth(1.0f)
 		[
 			SAssignNew(TextBoxWidget, SEditableTextBox)
-			.Text(this, &Self::GetTextValue)
+			.Text(DisplayedText)
 			.SelectAllTextWhenFocused(true)
 			.ClearKeyboardFocusOnCommit(false)
 			.SelectAllTextOnCommit(true)
@@ -194,8 +118,40 @@ void SDlgDataTextPropertyValue::Construct(const FArguments& InArgs, const TShare
 	PrimaryWidget = TextBoxWidget;
 }
 
+void SDlgDataTextPropertyValue::HandleVariableValueChanged()
+{
+	if (!TextBoxWidget.IsValid())
+	{
+		return;
+	}
+
+	// Do not overwrite what the user is typing, the value is pushed once the text box loses the focus
+	if (TextBoxWidget->HasKeyboardFocus())
+	{
+		bHasPendingValue = true;
+		return;
+	}
+
+	SetDisplayedText(GetTextValue());
+}
+
+void SDlgDataTextPropertyValue::SetDisplayedText(const FText& NewText)
+{
+	bHasPendingValue = false;
+	DisplayedText = NewText;
+	TextBoxWidget->SetText(NewText);
+}
+
 void SDlgDataTextPropertyValue::HandleTextCommitted(const FText& NewText, ETextCommit::Type CommitInfo)
 {
+	// The focus was lost (or escape pressed) without editing the text, do not write the old text over the newer sampled value
+	const bool bCommitOnFocusLost = CommitInfo == ETextCommit::OnUserMovedFocus || CommitInfo == ETextCommit::OnCleared;
+	if (bHasPendingValue && bCommitOnFocusLost && NewText.EqualTo(DisplayedText))
+	{
+		SetDisplayedText(GetTextValue());
+		return;
+	}
+
 	static const FString MultipleValues(TEXT("Multiple Values"));
 	const FString NewString = NewText.ToString();
 	if (NewString == MultipleValues || !VariableNode.IsValid())
@@ -279,7 +235,9 @@ void SDlgDataTextPropertyValue::HandleTextCommitted(const FText& NewText, ETextC
 			break;
 	}
 
+	// Always display the value the actor ended up with, even if we still have focus
 	UpdateVariableNodeFromActor();
+	SetDisplayedText(GetTextValue());
 }
 
 void SDlgDataTextPropertyValue::HandleTextChanged(const FText& NewText)
@@ -290,6 +248,11 @@ void SDlgDataTextPropertyValue::HandleTextChanged(const FText& NewText)
 		if (!ErrorMessage.IsEmpty())
 		{
 			VariableNode->SetVariableValue(ErrorMessage.ToString());
+			TextBoxWidget->SetError(ErrorMessage);
+		}
+		else
+		{
+			TextBoxWidget->SetError(FText::GetEmpty());
 		}
 	}
 }
@@ -368,7 +331,11 @@ FReply SDlgDataEventPropertyValue::HandleTriggerEventClicked()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // SDlgDataBoolPropertyValue
-void SDlgDataBoolPropertyValue::Construct(const FArguments& InArgs, const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode)
+void SDlgDataBoolPropertyValue::Construct(
+	const FArguments& InArgs,
+	const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode,
+	const TSharedPtr<FDlgDataDisplayValueSampler>& InValueSampler
+)
 {
 	VariableNode = InVariableNode;
 	if (!VariableNode.IsValid())
@@ -377,11 +344,12 @@ void SDlgDataBoolPropertyValue::Construct(const FArguments& InArgs, const TShare
 	}
 
 	UpdateVariableNodeFromActor();
+	RegisterToValueSampler(InValueSampler);
 	ChildSlot
 	[
 		SAssignNew(CheckBoxWidget, SCheckBox)
 		.OnCheckStateChanged(this, &Self::HandleCheckStateChanged)
-		.IsChecked(this, &Self::IsChecked)
+		.IsChecked(IsChecked())
 		.Padding(0.0f)
 	];
 	PrimaryWidget = CheckBoxWidget;
@@ -408,6 +376,14 @@ FReply SDlgDataBoolPropertyValue::OnMouseButtonDoubleClick(const FGeometry& InMy
 	return FReply::Unhandled();
 }
 
+void SDlgDataBoolPropertyValue::HandleVariableValueChanged()
+{
+	if (CheckBoxWidget.IsValid())
+	{
+		CheckBoxWidget->SetIsChecked(IsChecked());
+	}
+}
+
 ECheckBoxState SDlgDataBoolPropertyValue::IsChecked() const
 {
 	if (!VariableNode.IsValid())
@@ -5,9 +5,11 @@
 
 #include "DlgDataDisplayTreeNode.h"
 #include "DlgDataDisplayActorProperties.h"
+#include "DlgDataDisplayValueSampler.h"
 
 class SEditableTextBox;
 class SCheckBox;
+class STextBlock;
 
 
 /** The base type PropertyValue Widget. If just used by itself it displays the VariableValue as a static text. */
@@ -19,19 +21,14 @@ public:
 	SLATE_BEGIN_ARGS(Self) {}
 	SLATE_END_ARGS()
 
-	void Construct(const FArguments& InArgs, const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode);
+	void Construct(
+		const FArguments& InArgs,
+		const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode,
+		const TSharedPtr<FDlgDataDisplayValueSampler>& InValueSampler
+	);
 
 	// SWidget Interface
 
-	/**
-	 * Ticks this widget with Geometry.  Override in derived classes, but always call the parent implementation.
-	 *
-	 * @param  AllottedGeometry The space allotted for this widget
-	 * @param  InCurrentTime  Current absolute real time
-	 * @param  InDeltaTime  Real time passed since last tick
-	 */
-	void Tick(const FGeometry& AllottedGeometry, double InCurrentTime, float InDeltaTime) override;
-
 	/**
 	 * Checks to see if this widget supports keyboard focus.  Override this in derived classes.
 	 *
@@ -68,6 +65,12 @@ protected:
 	/** Updates the VariableNode value from the Actor. */
 	void UpdateVariableNodeFromActor();
 
+	/** Registers this widget so that the sampler updates our VariableNode value. */
+	void RegisterToValueSampler(const TSharedPtr<FDlgDataDisplayValueSampler>& InValueSampler);
+
+	/** Called only when the value of the VariableNode changed, pushes the new value into the widgets. */
+	virtual void HandleVariableValueChanged();
+
 protected:
 	/** The Node this widget value represents */
 	TSharedPtr<FDlgDataDisplayTreeVariableNode> VariableNode;
@@ -75,10 +78,8 @@ protected:
 	/** Primary Widget of this PropertyValue */
 	TSharedPtr<SWidget> PrimaryWidget;
 
-	/** Number of seconds passed in the Tick */
-	float TickPassedDeltaTimeSeconds = 0.f;
-
-	static constexpr float TickUpdateTimeSeconds = 1.0f;
+	/** Static text, only used if this is not a derived widget */
+	TSharedPtr<STextBlock> TextBlockWidget;
 };
 
 
@@ -90,18 +91,32 @@ public:
 	SLATE_BEGIN_ARGS(Self) {}
 	SLATE_END_ARGS()
 
-	void Construct(const FArguments& InArgs, const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode);
+	void Construct(
+		const FArguments& InArgs,
+		const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode,
+		const TSharedPtr<FDlgDataDisplayValueSampler>& InValueSampler
+	);
 
 protected:
+	void HandleVariableValueChanged() override;
 	void HandleTextCommitted(const FText& NewText, ETextCommit::Type CommitInfo);
 	void HandleTextChanged(const FText& NewText);
 
+	// Sets the text of the TextBoxWidget, the pending value is not needed anymore
+	void SetDisplayedText(const FText& NewText);
+
 	bool IsReadOnly() const { return !VariableNode.IsValid(); }
 
 protected:
 	/** Widget used for the single line version of the text property */
 	TSharedPtr<SEditableTextBox> TextBoxWidget;
 
+	/** The text last set into the TextBoxWidget, used to know if the user edited it */
+	FText DisplayedText;
+
+	/** The value changed while the TextBoxWidget had the keyboard focus, the VariableNode has the new value */
+	bool bHasPendingValue = false;
+
 	/** True if property is an FName property which causes us to run extra size validation checks */
 	bool bIsFNameProperty = false;
 };
@@ -117,12 +132,6 @@ public:
 
 	void Construct(const FArguments& InArgs, const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode);
 
-	// SWidget Interface
-	void Tick(const FGeometry& AllottedGeometry, double InCurrentTime, float InDeltaTime) override
-	{
-		SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
-	}
-
 protected:
 	FReply HandleTriggerEventClicked();
 	FReply HandleTriggerEventClicked_Function();
@@ -137,7 +146,11 @@ public:
 	SLATE_BEGIN_ARGS(Self) {}
 	SLATE_END_ARGS()
 
-	void Construct(const FArguments& InArgs, const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode);
+	void Construct(
+		const FArguments& InArgs,
+		const TSharedPtr<FDlgDataDisplayTreeVariableNode>& InVariableNode,
+		const TSharedPtr<FDlgDataDisplayValueSampler>& InValueSampler
+	);
 
 	// SWidget interface
 	bool HasKeyboardFocus() const override;
@@ -152,6 +165,7 @@ public:
 	FReply OnMouseButtonDoubleClick(const FGeometry& InMyGeometry, const FPointerEvent& InMouseEvent) override;
 
 protected:
+	void HandleVariableValueChanged() override;
 	ECheckBoxState IsChecked() const;
 	void HandleCheckStateChanged(ECheckBoxState InNewState);
 	bool IsBoolProperty() const { return VariableNode->GetVariableType() == EDlgDataDisplayVariableTreeNodeType::Bool ||
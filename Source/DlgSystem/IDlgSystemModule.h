@@ -11,6 +11,7 @@ class AActor;
 class SWidget;
 class SDockTab;
 struct FTabSpawnerEntry;
+struct FStreamableManager;
 
 /**
  * Interface for the DlgSystem module.
@@ -60,4 +61,7 @@ public:
 
 	// Display the debug Dialogue Data Window on the screen
 	virtual void DisplayDialogueDataWindow() = 0;
+
+	// Streams the soft referenced assets of the active nodes, see UDlgSystemSettings::bUseSoftReferencesForNodeAssets
+	virtual FStreamableManager& GetStreamableManager() = 0;
 };
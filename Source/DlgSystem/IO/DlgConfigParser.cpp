@@ -512,6 +512,10 @@ bool FDlgConfigParser::TryToReadPrimitiveProperty(void* TargetObject, FProperty*
 	{
 		return true;
 	}
+	if (ReadPrimitiveProperty<FSoftObjectPtr, FSoftObjectProperty>(TargetObject, PropertyBase, std::bind(&FDlgConfigParser::GetAsSoftObject, this), "FSoftObjectPtr", true))
+	{
+		return true;
+	}
 
 	return false;
 }
@@ -799,3 +803,10 @@ FText FDlgConfigParser::GetAsText() const
 
 	return FText::FromString(Input);
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FSoftObjectPtr FDlgConfigParser::GetAsSoftObject() const
+{
+	// Empty string means a null soft reference
+	return FSoftObjectPtr(FSoftObjectPath(GetAsString()));
+}
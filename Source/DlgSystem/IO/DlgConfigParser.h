@@ -4,6 +4,7 @@
 #include <functional>
 #include "CoreTypes.h"
 #include "Logging/LogMacros.h"
+#include "UObject/SoftObjectPtr.h"
 
 #include "IDlgParser.h"
 #include "DlgSystem/NYReflectionHelper.h"
@@ -243,6 +244,7 @@ private:
 	FName GetAsName() const;
 	FString GetAsString() const;
 	FText GetAsText() const;
+	FSoftObjectPtr GetAsSoftObject() const;
 
 	void OnInvalidValue(const FString& PropType) const;
 
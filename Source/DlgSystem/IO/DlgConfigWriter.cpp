@@ -198,6 +198,10 @@ bool FDlgConfigWriter::WritePrimitiveElementToString(const FProperty* Property,
 	{
 		return true;
 	}
+	if (WritePrimitiveElementToStringTemplated<FSoftObjectProperty, FSoftObjectPtr>(Property, Object, bInContainer, SoftObjectToString, PreS, PostS, Target))
+	{
+		return true;
+	}
 
 	// TODO: enum in container - why isn't it implemented in the reader?
 	if (!bInContainer)
@@ -261,6 +265,10 @@ bool FDlgConfigWriter::WritePrimitiveArrayToString(const FProperty* Property,
 	{
 		return true;
 	}
+	if (WritePrimitiveArrayToStringTemplated<FSoftObjectProperty, FSoftObjectPtr>(ArrayProp, Object, SoftObjectToString, PreString, PostString, Target))
+	{
+		return true;
+	}
 
 	return false;
 }
@@ -603,6 +611,7 @@ bool FDlgConfigWriter::IsPrimitive(const FProperty* Property)
 		   FNYReflectionHelper::CastProperty<FStrProperty>(Property) != nullptr ||
 		   FNYReflectionHelper::CastProperty<FNameProperty>(Property) != nullptr ||
 		   FNYReflectionHelper::CastProperty<FTextProperty>(Property) != nullptr ||
+		   FNYReflectionHelper::CastProperty<FSoftObjectProperty>(Property) != nullptr ||
 		   FNYReflectionHelper::CastProperty<FEnumProperty>(Property) != nullptr;
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -298,4 +298,9 @@ private:
 	{
 		return FString("\"") + NormalizeEndlines(Text.ToString()) + "\"";
 	};
+
+	const std::function<FString(const FSoftObjectPtr&)> SoftObjectToString = [](const FSoftObjectPtr& SoftObject) -> FString
+	{
+		return FString("\"") + SoftObject.ToString() + "\"";
+	};
 };
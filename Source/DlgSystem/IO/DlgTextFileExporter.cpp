@@ -0,0 +1,77 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgTextFileExporter.h"
+
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+
+DEFINE_LOG_CATEGORY(LogDlgTextFileExporter);
+
+void FDlgTextFileExporter::WriteAsync(const FString& FileName, FString&& Contents)
+{
+	check(IsInGameThread());
+	RemoveFinishedWrites();
+
+	// Never write the same file from two tasks
+	Flush(FileName);
+
+	// The exporter is a singleton and flushed on shutdown, it outlives the task
+	PendingWrites.Add(
+		FileName,
+		Async(EAsyncExecution::ThreadPool, [this, FileName, Contents = MoveTemp(Contents)]() -> bool
+		{
+			return WriteIfChanged(FileName, Contents);
+		})
+	);
+}
+
+void FDlgTextFileExporter::Flush()
+{
+	check(IsInGameThread());
+	for (auto& Elem : PendingWrites)
+	{
+		Elem.Value.Wait();
+	}
+	PendingWrites.Empty();
+}
+
+void FDlgTextFileExporter::Flush(const FString& FileName)
+{
+	check(IsInGameThread());
+	if (TFuture<bool>* PendingWrite = PendingWrites.Find(FileName))
+	{
+		PendingWrite->Wait();
+		PendingWrites.Remove(FileName);
+	}
+}
+
+void FDlgTextFileExporter::RemoveFinishedWrites()
+{
+	for (auto It = PendingWrites.CreateIterator(); It; ++It)
+	{
+		if (It->Value.IsReady())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool FDlgTextFileExporter::WriteIfChanged(const FString& FileName, const FString& Contents)
+{
+	// Same contents, do not touch the file
+	FString ExistingContents;
+	if (IFileManager::Get().FileExists(*FileName) && FFileHelper::LoadFileToString(ExistingContents, *FileName)
+		&& ExistingContents.Equals(Contents, ESearchCase::CaseSensitive))
+	{
+		NumSkippedWrites.Increment();
+		return true;
+	}
+
+	if (!FFileHelper::SaveStringToFile(Contents, *FileName, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogDlgTextFileExporter, Error, TEXT("Failed to write the text file = `%s`"), *FileName);
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,58 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Logging/LogMacros.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgTextFileExporter, All, All);
+
+/**
+ * Writes the Dialogue text files on background tasks.
+ * The contents are serialized on the game thread (the writers read the UObjects), only the comparison with the existing
+ * file and the write happen in the background. Files that already have the same contents are not touched, so their
+ * timestamp and source control state do not change.
+ *
+ * Call Flush before reading, moving or deleting the text files or before handing them to source control.
+ * NOTE: all the methods must be called from the game thread.
+ */
+class DLGSYSTEM_API FDlgTextFileExporter
+{
+	typedef FDlgTextFileExporter Self;
+
+public:
+	static FDlgTextFileExporter& Get()
+	{
+		static FDlgTextFileExporter Instance;
+		return Instance;
+	}
+
+	// Writes the Contents into the FileName on a background task
+	// A pending write of the same file is finished first, so the last call always wins
+	void WriteAsync(const FString& FileName, FString&& Contents);
+
+	// Blocks until all the pending writes are finished, the completion barrier
+	void Flush();
+
+	// Blocks until the pending write of FileName is finished
+	void Flush(const FString& FileName);
+
+	bool HasPendingWrites() const { return PendingWrites.Num() > 0; }
+
+	// Number of writes skipped because the file already had the same contents
+	int32 GetNumSkippedWrites() const { return NumSkippedWrites.GetValue(); }
+
+protected:
+	// Removes the finished writes
+	void RemoveFinishedWrites();
+
+	// Runs on the background task, @return false if the write failed
+	bool WriteIfChanged(const FString& FileName, const FString& Contents);
+
+protected:
+	// Key: Full file name
+	// Value: The background write of that file
+	TMap<FString, TFuture<bool>> PendingWrites;
+
+	FThreadSafeCounter NumSkippedWrites;
+};
@@ -130,21 +130,33 @@ void UDlgNode::PostEditChangeChainProperty(struct FPropertyChangedChainEvent& Pr
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Begin own function
-bool UDlgNode::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*> NodesEnteredWithThisStep)
+bool UDlgNode::HandleNodeEnter(UDlgContext& Context)
 {
 	// Fire all the node enter events
 	FireNodeEnterEvents(Context);
 
+	// The barks only read this node, there are no options
+	if (Context.IsEvaluatingBark())
+	{
+		return true;
+	}
+
 	for (FDlgEdge& Edge : Children)
 	{
 		Edge.RebuildConstructedText(Context, OwnerName);
 	}
 
-	return ReevaluateChildren(Context, {});
+	return Context.ReevaluateNodeChildren(*this);
 }
 
 void UDlgNode::FireNodeEnterEvents(UDlgContext& Context)
 {
+	FDlgEventCommandBuffer* CommandBuffer = nullptr;
+	if (EnterEvents.Num() > 0 && GetDefault<UDlgSystemSettings>()->bDeferNodeEnterEvents)
+	{
+		CommandBuffer = &Context.GetEventCommandBuffer();
+	}
+
 	for (const FDlgEvent& Event : EnterEvents)
 	{
 		// Get Participant from either event or parent
@@ -154,20 +166,34 @@ void UDlgNode::FireNodeEnterEvents(UDlgContext& Context)
 			Participant = Context.GetMutableParticipant(OwnerName);
 		}
 
-		Event.Call(Context, TEXT("FireNodeEnterEvents"), Participant);
+		if (CommandBuffer)
+		{
+			CommandBuffer->Add(Event, Participant);
+		}
+		else
+		{
+			Event.Call(Context, TEXT("FireNodeEnterEvents"), Participant);
+		}
+	}
+
+	// Apply before anything is evaluated, the conditions of the children might depend on the modified values
+	if (CommandBuffer)
+	{
+		CommandBuffer->Apply(Context, TEXT("FireNodeEnterEvents"));
 	}
 }
 
-bool UDlgNode::ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNode*> AlreadyEvaluated)
+bool UDlgNode::ReevaluateChildren(UDlgContext& Context)
 {
 	TArray<FDlgEdge>& AvailableOptions = Context.GetMutableOptionsArray();
 	TArray<FDlgEdgeData>& AllOptions = Context.GetAllMutableOptionsArray();
 	AvailableOptions.Empty();
 	AllOptions.Empty();
 
+	const FDlgEvaluationPathScope PathScope(Context, this);
 	for (const FDlgEdge& Edge : Children)
 	{
-		const bool bSatisfied = Edge.Evaluate(Context, { this });
+		const bool bSatisfied = Edge.Evaluate(Context);
 
 		if (bSatisfied || Edge.bIncludeInAllOptionListIfUnsatisfied)
 		{
@@ -203,14 +229,8 @@ bool UDlgNode::ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNode*> Al
 	return true;
 }
 
-bool UDlgNode::CheckNodeEnterConditions(const UDlgContext& Context, TSet<const UDlgNode*> AlreadyVisitedNodes) const
+bool UDlgNode::CheckNodeEnterConditions(const UDlgContext& Context) const
 {
-	if (AlreadyVisitedNodes.Contains(this))
-	{
-		return true;
-	}
-
-	AlreadyVisitedNodes.Add(this);
 	if (!FDlgCondition::EvaluateArray(Context, EnterConditions, OwnerName))
 	{
 		return false;
@@ -245,15 +265,15 @@ bool UDlgNode::CheckNodeEnterConditions(const UDlgContext& Context, TSet<const U
 	}
 
 	// Has a valid child?
-	return HasAnySatisfiedChild(Context, AlreadyVisitedNodes);
+	return HasAnySatisfiedChild(Context);
 }
 
-bool UDlgNode::HasAnySatisfiedChild(const UDlgContext& Context, TSet<const UDlgNode*> AlreadyVisitedNodes) const
+bool UDlgNode::HasAnySatisfiedChild(const UDlgContext& Context) const
 {
 	for (const FDlgEdge& Edge : Children)
 	{
 		// Found at least one valid child
-		if (Edge.Evaluate(Context, AlreadyVisitedNodes))
+		if (Edge.Evaluate(Context))
 		{
 			return true;
 		}
@@ -270,7 +290,7 @@ bool UDlgNode::OptionSelected(int32 OptionIndex, bool bFromAll, UDlgContext& Con
 		if (AllOptions.IsValidIndex(OptionIndex))
 		{
 			check(AllOptions[OptionIndex].IsValid());
-			return Context.EnterNode(AllOptions[OptionIndex].GetEdge().TargetIndex, {});
+			return Context.EnterNode(AllOptions[OptionIndex].GetEdge().TargetIndex);
 		}
 
 		FDlgLogger::Get().Errorf(
@@ -284,7 +304,7 @@ bool UDlgNode::OptionSelected(int32 OptionIndex, bool bFromAll, UDlgContext& Con
 		if (AvailableOptions.IsValidIndex(OptionIndex))
 		{
 			check(AvailableOptions[OptionIndex].IsValid());
-			return Context.EnterNode(AvailableOptions[OptionIndex].TargetIndex, {});
+			return Context.EnterNode(AvailableOptions[OptionIndex].TargetIndex);
 		}
 
 		FDlgLogger::Get().Errorf(
@@ -377,6 +397,37 @@ void UDlgNode::UpdateTextsNamespacesAndKeys(const UDlgSystemSettings& Settings,
 	}
 }
 
+#if WITH_EDITOR
+bool UDlgNode::InternEdgeTextsIntoStringTable(UStringTable& StringTable, bool bUpdateGraphNode)
+{
+	bool bInterned = false;
+	for (FDlgEdge& Edge : Children)
+	{
+		if (Edge.IsValid())
+		{
+			bInterned |= FDlgLocalizationHelper::InternTextIntoStringTable(StringTable, Edge.GetMutableUnformattedText());
+		}
+	}
+
+	if (bInterned && bUpdateGraphNode)
+	{
+		UpdateGraphNode();
+	}
+	return bInterned;
+}
+#endif
+
+void UDlgNode::CompactRuntimeData(TMap<FString, FText>& SharedTexts)
+{
+	EnterConditions.Shrink();
+	EnterEvents.Shrink();
+	Children.Shrink();
+	for (FDlgEdge& Edge : Children)
+	{
+		Edge.CompactRuntimeData(SharedTexts);
+	}
+}
+
 void UDlgNode::RebuildTextArguments(bool bEdges, bool bUpdateGraphNode)
 {
 	if (bEdges)
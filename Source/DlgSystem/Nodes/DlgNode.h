@@ -22,6 +22,7 @@ class UDlgNode;
 class USoundBase;
 class USoundWave;
 class UDialogueWave;
+class UStringTable;
 struct FDlgTextArgument;
 class UDlgDialogue;
 
@@ -99,11 +100,12 @@ public:
 	DECLARE_EVENT_TwoParams(UDlgNode, FDialogueNodePropertyChanged, const FPropertyChangedEvent& /* PropertyChangedEvent */, int32 /* EdgeIndexChanged */);
 	FDialogueNodePropertyChanged OnDialogueNodePropertyChanged;
 
-	virtual bool HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*> NodesEnteredWithThisStep);
-	virtual bool ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNode*> AlreadyEvaluated);
+	virtual bool HandleNodeEnter(UDlgContext& Context);
+	virtual bool ReevaluateChildren(UDlgContext& Context);
 
-	virtual bool CheckNodeEnterConditions(const UDlgContext& Context, TSet<const UDlgNode*> AlreadyVisitedNodes) const;
-	bool HasAnySatisfiedChild(const UDlgContext& Context, TSet<const UDlgNode*> AlreadyVisitedNodes) const;
+	// Checks the enter conditions of this node, use UDlgContext::IsNodeEnterable to also guard against endless loops
+	virtual bool CheckNodeEnterConditions(const UDlgContext& Context) const;
+	bool HasAnySatisfiedChild(const UDlgContext& Context) const;
 
 	// if bFromAll = true it uses all the options (even unsatisfied)
 	// if bFromAll = false it only uses the satisfied options.
@@ -224,6 +226,15 @@ public:
 	// Updates the namespace and key of all the texts depending on the settings
 	virtual void UpdateTextsNamespacesAndKeys(const UDlgSystemSettings& Settings, bool bEdges, bool bUpdateGraphNode = true);
 
+#if WITH_EDITOR
+	// Replaces the edge texts with the entries of the StringTable, see FDlgLocalizationHelper::InternTextIntoStringTable
+	// Return true if any text was replaced
+	virtual bool InternEdgeTextsIntoStringTable(UStringTable& StringTable, bool bUpdateGraphNode = true);
+#endif
+
+	// Shrinks the arrays and shares the texts with the identical ones, see UDlgDialogue::CompactRuntimeData
+	virtual void CompactRuntimeData(TMap<FString, FText>& SharedTexts);
+
 	// Rebuilds ConstructedText
 	virtual void RebuildTextArguments(bool bEdges, bool bUpdateGraphNode = true);
 	virtual void RebuildTextArgumentsFromPreview(const FText& Preview) {}
@@ -277,6 +288,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Dialogue|Node")
 	virtual UDlgNodeData* GetNodeData() const { return nullptr; }
 
+	// Same as the getters above only they also return the assets that are not loaded yet
+	// See UDlgSystemSettings::bUseSoftReferencesForNodeAssets
+	virtual TSoftObjectPtr<USoundBase> GetNodeSoftVoiceSoundBase() const { return nullptr; }
+	virtual TSoftObjectPtr<UDialogueWave> GetNodeSoftVoiceDialogueWave() const { return nullptr; }
+	virtual TSoftObjectPtr<UObject> GetNodeSoftGenericData() const { return nullptr; }
+
+	// Adds all the soft referenced assets of this Node, the context streams them while this Node is active
+	virtual void GetNodeSoftAssets(TArray<FSoftObjectPath>& OutAssetPaths) const {}
+
+	// Moves the assets of this Node between the hard and soft references, see UDlgSystemSettings::bUseSoftReferencesForNodeAssets
+	virtual void ConvertNodeAssetReferences(bool bToSoftReferences) {}
+
 	// Helper method to get directly the Dialogue (which is our parent)
 	UDlgDialogue* GetDialogue() const;
 
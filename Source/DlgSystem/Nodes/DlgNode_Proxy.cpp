@@ -4,36 +4,23 @@
 #include "DlgSystem/DlgContext.h"
 #include "DlgSystem/Logging/DlgLogger.h"
 
-bool UDlgNode_Proxy::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*> NodesEnteredWithThisStep)
+bool UDlgNode_Proxy::HandleNodeEnter(UDlgContext& Context)
 {
 	FireNodeEnterEvents(Context);
 
-	if (NodesEnteredWithThisStep.Contains(this))
-	{
-		FDlgLogger::Get().Errorf(
-			TEXT("ProxyNode::HandleNodeEnter - Failed to enter proxy node, it was entered multiple times in a single step."
-					"Theoretically with some condition magic it could make sense, but chances are that it is an endless loop,"
-					"thus entering the same proxy twice with a single step is not supported. Dialogue is terminated.\nContext:\n\t%s"),
-			*Context.GetContextString()
-		);
-
-		return false;
-	}
-	NodesEnteredWithThisStep.Add(this);
-
-	return Context.EnterNode(NodeIndex, NodesEnteredWithThisStep);
+	// Entering the same proxy twice with a single step is guarded by the context
+	return Context.EnterNode(NodeIndex);
 }
 
-bool UDlgNode_Proxy::CheckNodeEnterConditions(const UDlgContext& Context, TSet<const UDlgNode*> AlreadyVisitedNodes) const
+bool UDlgNode_Proxy::CheckNodeEnterConditions(const UDlgContext& Context) const
 {
-	if (!Super::CheckNodeEnterConditions(Context, AlreadyVisitedNodes))
+	if (!Super::CheckNodeEnterConditions(Context))
 	{
 		return false;
 	}
 
-	const UDlgNode* Node = Context.GetNodeFromIndex(NodeIndex);
-	check(Node);
-	return Node->CheckNodeEnterConditions(Context, AlreadyVisitedNodes);
+	check(Context.GetNodeFromIndex(NodeIndex));
+	return Context.IsNodeEnterable(NodeIndex);
 }
 
 void UDlgNode_Proxy::RemapOldIndicesWithNew(const TMap<int32, int32>& OldToNewIndexMap)
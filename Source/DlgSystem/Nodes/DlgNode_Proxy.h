@@ -29,8 +29,8 @@ public:
 	// Begin UDlgNode Interface.
 	//
 
-	bool HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*> NodesEnteredWithThisStep) override;
-	virtual bool CheckNodeEnterConditions(const UDlgContext& Context, TSet<const UDlgNode*> AlreadyVisitedNodes) const override;
+	bool HandleNodeEnter(UDlgContext& Context) override;
+	virtual bool CheckNodeEnterConditions(const UDlgContext& Context) const override;
 
 #if WITH_EDITOR
 	FString GetNodeTypeString() const override { return TEXT("Proxy"); }
@@ -1,6 +1,8 @@
 // Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
 #include "DlgNode_Selector.h"
 
+#include "Algo/BinarySearch.h"
+
 #include "DlgSystem/DlgContext.h"
 #include "DlgSystem/Logging/DlgLogger.h"
 
@@ -31,6 +33,12 @@ const FText& UDlgNode_Selector::GetNodeText() const
 			return DynamicDisplayText;
 		}
 
+		case EDlgNodeSelectorType::WeightedRandom:
+		{
+			static const FText SelectWeightedRandomText = FText::FromString("Weighted Random Satisfied");
+			return SelectWeightedRandomText;
+		}
+
 		default:
 		{
 			return FText::GetEmpty();
@@ -38,34 +46,20 @@ const FText& UDlgNode_Selector::GetNodeText() const
 	}
 }
 
-bool UDlgNode_Selector::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*> NodesEnteredWithThisStep)
+bool UDlgNode_Selector::HandleNodeEnter(UDlgContext& Context)
 {
 	FireNodeEnterEvents(Context);
 
-	if (NodesEnteredWithThisStep.Contains(this))
-	{
-		FDlgLogger::Get().Errorf(
-			TEXT("SelectorNode::HandleNodeEnter - Failed to enter selector node, it was entered multiple times in a single step."
-					"Theoretically with some condition magic it could make sense, but chances are that it is an endless loop,"
-					"thus entering the same selector twice with a single step is not supported. Dialogue is terminated.\nContext:\n\t%s"),
-			*Context.GetContextString()
-		);
-
-		return false;
-	}
-	NodesEnteredWithThisStep.Add(this);
-
+	// Entering the same selector twice with a single step is guarded by the context
 	switch (SelectorType)
 	{
 		case EDlgNodeSelectorType::First:
 		{
 			// Find first child with satisfies conditions
-			for (const FDlgEdge& Edge : Children)
+			const int32 ChildNodeIndex = GetFirstSatisfiedChildNodeIndex(Context);
+			if (ChildNodeIndex != INDEX_NONE)
 			{
-				if (Edge.Evaluate(Context, { this }))
-				{
-					return Context.EnterNode(Edge.TargetIndex, NodesEnteredWithThisStep);
-				}
+				return Context.EnterNode(ChildNodeIndex);
 			}
 			break;
 		}
@@ -76,8 +70,19 @@ bool UDlgNode_Selector::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNod
 			const int32 ChildNodeIndex = GetRandomChildNodeIndex(Context);
 			if (ChildNodeIndex != INDEX_NONE)
 			{
-				return Context.EnterNode(ChildNodeIndex, NodesEnteredWithThisStep);
+				return Context.EnterNode(ChildNodeIndex);
+			}
+			break;
+		}
+
+		case EDlgNodeSelectorType::WeightedRandom:
+		{
+			const int32 ChildNodeIndex = GetWeightedRandomChildNodeIndex(Context);
+			if (ChildNodeIndex != INDEX_NONE)
+			{
+				return Context.EnterNode(ChildNodeIndex);
 			}
+			break;
 		}
 
 		default:
@@ -91,74 +96,161 @@ bool UDlgNode_Selector::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNod
 	return false;
 }
 
-int32 UDlgNode_Selector::GetRandomChildNodeIndex(UDlgContext& Context)
+int32 UDlgNode_Selector::GetFirstSatisfiedChildNodeIndex(const UDlgContext& Context) const
 {
-	FDlgNodeSavedData& SavedData = Context.GetNodeSavedData(NodeGUID);
-
-	// The list of all valid children (ones with satisfied condition)
-	TArray<int32> Candidates;
+	const FDlgEvaluationPathScope PathScope(Context, this);
+	for (const FDlgEdge& Edge : Children)
+	{
+		if (Edge.Evaluate(Context))
+		{
+			return Edge.TargetIndex;
+		}
+	}
 
-	// List of possible candidates if we want to avoid repetition based on the booleans
-	TArray<int32> CandidatesLimited;
+	return INDEX_NONE;
+}
 
-	for (int32 EdgeIndex = 0; EdgeIndex < Children.Num(); ++EdgeIndex)
+int32 UDlgNode_Selector::GetRandomChildNodeIndex(UDlgContext& Context)
+{
+	// The valid children (ones with satisfied condition), inline up to 128 children
+	TBitArray<> Satisfied(false, Children.Num());
+	int32 NumSatisfied = 0;
 	{
-		if (Children[EdgeIndex].Evaluate(Context, { this }))
+		const FDlgEvaluationPathScope PathScope(Context, this);
+		for (int32 EdgeIndex = 0; EdgeIndex < Children.Num(); ++EdgeIndex)
 		{
-			Candidates.Add(EdgeIndex);
-
-			const FGuid ChildNodeGUID = Context.GetNodeGUIDForIndex(Children[EdgeIndex].TargetIndex);
-			if (!SavedData.GUIDList.Contains(ChildNodeGUID))
+			if (Children[EdgeIndex].Evaluate(Context))
 			{
-				CandidatesLimited.Add(EdgeIndex);
+				Satisfied[EdgeIndex] = true;
+				NumSatisfied++;
 			}
 		}
 	}
 
 	// No candidates :(
-	if (Candidates.Num() == 0)
+	if (NumSatisfied == 0)
 	{
 		return INDEX_NONE;
 	}
 
-	// Option cycle is over or something is wrong with the setup
-	if (CandidatesLimited.Num() == 0)
+	// The saved data is only read and written under the lock of the dialogue memory, the conditions above read the memory too
+	int32 SelectedEdgeIndex = INDEX_NONE;
+	Context.ModifyNodeSavedData(NodeGUID, [this, &Context, &Satisfied, NumSatisfied, &SelectedEdgeIndex](FDlgNodeSavedData& SavedData)
 	{
-		// Only allow to preserve last option in list if it is needed and we are sure that
-		// a valid option can be picked even if it stays there
-		const bool bTempBlockLast = bAvoidPickingSameOptionTwiceInARow && Candidates.Num() > 1;
-		if (bTempBlockLast)
-		{
-			const FGuid TempBlockedEntry = SavedData.GUIDList.Last();
-			SavedData.GUIDList.Empty();
-			SavedData.GUIDList.Add(TempBlockedEntry);
-			const int32 RandomChildNodeIndex = GetRandomChildNodeIndex(Context);
-			SavedData.GUIDList.Remove(TempBlockedEntry);
-			return RandomChildNodeIndex;
+		// Saves from before the edge mask stored the picked target node GUIDs
+		if (SavedData.GUIDList.Num() > 0)
+		{
+			TArray<FGuid> EdgeTargetGUIDs;
+			EdgeTargetGUIDs.Reserve(Children.Num());
+			for (const FDlgEdge& Edge : Children)
+			{
+				EdgeTargetGUIDs.Add(Context.GetNodeGUIDForIndex(Edge.TargetIndex));
+			}
+			SavedData.ConvertGUIDListToUsedEdges(EdgeTargetGUIDs);
+		}
+		SavedData.InitUsedEdges(Children.Num());
+
+		auto IsExcluded = [this, &SavedData](int32 EdgeIndex) -> bool
+		{
+			if (bCycleThroughSatisfiedOptionsWithoutRepetition)
+			{
+				return SavedData.IsEdgeUsed(EdgeIndex);
+			}
+			return bAvoidPickingSameOptionTwiceInARow && EdgeIndex == SavedData.LastEdgeIndex;
+		};
+
+		// The satisfied children not excluded by the booleans
+		int32 NumCandidates = 0;
+		for (int32 EdgeIndex = 0; EdgeIndex < Children.Num(); ++EdgeIndex)
+		{
+			if (Satisfied[EdgeIndex] && !IsExcluded(EdgeIndex))
+			{
+				NumCandidates++;
+			}
+		}
+
+		// Option cycle is over or something is wrong with the setup
+		int32 BlockedEdgeIndex = INDEX_NONE;
+		const bool bRestart = NumCandidates == 0;
+		if (bRestart)
+		{
+			if (bCycleThroughSatisfiedOptionsWithoutRepetition)
+			{
+				SavedData.ResetUsedEdges();
+
+				// Only keep blocking the last option if a valid option can be picked even if it stays blocked
+				if (bAvoidPickingSameOptionTwiceInARow && NumSatisfied > 1)
+				{
+					BlockedEdgeIndex = SavedData.LastEdgeIndex;
+				}
+			}
+
+			const bool bBlockedSatisfied = Satisfied.IsValidIndex(BlockedEdgeIndex) && Satisfied[BlockedEdgeIndex];
+			NumCandidates = bBlockedSatisfied ? NumSatisfied - 1 : NumSatisfied;
+		}
+
+		// Select Random, find the n-th candidate
+		int32 Remaining = Context.RandomHelper(NumCandidates);
+		for (int32 EdgeIndex = 0; EdgeIndex < Children.Num(); ++EdgeIndex)
+		{
+			const bool bCandidate = Satisfied[EdgeIndex] && (bRestart ? EdgeIndex != BlockedEdgeIndex : !IsExcluded(EdgeIndex));
+			if (bCandidate && Remaining-- == 0)
+			{
+				SelectedEdgeIndex = EdgeIndex;
+				break;
+			}
 		}
-		else
+		check(SelectedEdgeIndex != INDEX_NONE);
+
+		// if we cycle through everything the picked edges are needed, they are cleared once all valid options are picked
+		if (bCycleThroughSatisfiedOptionsWithoutRepetition)
+		{
+			SavedData.SetEdgeUsed(SelectedEdgeIndex);
+		}
+		SavedData.LastEdgeIndex = SelectedEdgeIndex;
+	});
+
+	return Children[SelectedEdgeIndex].TargetIndex;
+}
+
+int32 UDlgNode_Selector::GetWeightedRandomChildNodeIndex(UDlgContext& Context) const
+{
+	// Running sum of the weights of the satisfied children, no allocation for the usual bark selectors
+	TArray<float, TInlineAllocator<32>> CumulativeWeights;
+	TArray<int32, TInlineAllocator<32>> CandidateEdgeIndices;
+	float TotalWeight = 0.f;
+	{
+		const FDlgEvaluationPathScope PathScope(Context, this);
+		for (int32 EdgeIndex = 0; EdgeIndex < Children.Num(); ++EdgeIndex)
 		{
-			SavedData.GUIDList.Empty();
-			return GetRandomChildNodeIndex(Context);
+			const FDlgEdge& Edge = Children[EdgeIndex];
+			if (Edge.Evaluate(Context))
+			{
+				TotalWeight += Edge.GetWeight(Context);
+				CumulativeWeights.Add(TotalWeight);
+				CandidateEdgeIndices.Add(EdgeIndex);
+			}
 		}
 	}
 
-	// Select Random
-	const int32 SelectedIndex = FMath::RandHelper(CandidatesLimited.Num());
-	const int32 TargetNodeIndex = Children[CandidatesLimited[SelectedIndex]].TargetIndex;
-	const FGuid TargetNodeGUID = Context.GetNodeGUIDForIndex(TargetNodeIndex);
+	// No candidates :(
+	if (CandidateEdgeIndices.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
 
-	// if we cycle through everything the list of picked nodes is needed
-	if (bCycleThroughSatisfiedOptionsWithoutRepetition)
+	int32 SelectedIndex = 0;
+	if (TotalWeight > 0.f)
 	{
-		// add the currently picked node to the disallow list, it will be cleared on selection if all valid options are added
-		SavedData.GUIDList.Add(TargetNodeGUID);
+		// The first child with a running sum above the picked value, the zero weighted children are never picked
+		const float PickedWeight = Context.GetRandomFraction() * TotalWeight;
+		SelectedIndex = FMath::Min(Algo::UpperBound(CumulativeWeights, PickedWeight), CandidateEdgeIndices.Num() - 1);
 	}
-	else if (bAvoidPickingSameOptionTwiceInARow)
+	else
 	{
-		// only disallow the currently picked node for the next selection
-		SavedData.GUIDList = { TargetNodeGUID };
+		// Every satisfied weight is zero, do not end the Dialogue because of it
+		SelectedIndex = Context.RandomHelper(CandidateEdgeIndices.Num());
 	}
 
-	return TargetNodeIndex;
+	return Children[CandidateEdgeIndices[SelectedIndex]].TargetIndex;
 }
@@ -15,6 +15,9 @@ enum class EDlgNodeSelectorType : uint8
 
 	// As soon as it is entered it selects a satisfied child randomly.
 	Random		UMETA(DisplayName = "Random"),
+
+	// As soon as it is entered it selects a satisfied child randomly, the chance of each child is given by FDlgEdge::GetWeight.
+	WeightedRandom		UMETA(DisplayName = "Weighted Random"),
 };
 
 /**
@@ -40,6 +43,8 @@ public:
 			return TEXT("Node without text and as soon as entered it selects its first satisfied child.\n It should have at least one (satisfied child), otherwise the Dialogue is terminated.");
 		case EDlgNodeSelectorType::Random:
 			return TEXT("Node without text and as soon as entered it selects a satisfied child randomly.\nIt should have at least one (satisfied child), otherwise the Dialogue is terminated.");
+		case EDlgNodeSelectorType::WeightedRandom:
+			return TEXT("Node without text and as soon as entered it selects a satisfied child randomly, weighted by the edge weights.\nIt should have at least one (satisfied child), otherwise the Dialogue is terminated.");
 		default:
 			return TEXT("UNHANDLED");
 		}
@@ -49,7 +54,7 @@ public:
 	// Begin UDlgNode Interface.
 	//
 
-	bool HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*> NodesEnteredWithThisStep) override;
+	bool HandleNodeEnter(UDlgContext& Context) override;
 
 #if WITH_EDITOR
 	FString GetNodeTypeString() const override { return TEXT("Selector"); }
@@ -66,6 +71,10 @@ public:
 	// Sets the Selector Type
 	void SetSelectorType(EDlgNodeSelectorType InType) { SelectorType = InType; }
 
+	// Sets the modifiers of EDlgNodeSelectorType::Random
+	void SetAvoidPickingSameOptionTwiceInARow(bool bValue) { bAvoidPickingSameOptionTwiceInARow = bValue; }
+	void SetCycleThroughSatisfiedOptionsWithoutRepetition(bool bValue) { bCycleThroughSatisfiedOptionsWithoutRepetition = bValue; }
+
 	// Helper functions to get the names of some properties. Used by the DlgSystemEditor module.
 	static FName GetMemberNameSelectorType() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Selector, SelectorType); }
 	static FName GetMemberNameAvoidPickingSameOptionTwiceInARow() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Selector, bAvoidPickingSameOptionTwiceInARow); }
@@ -73,7 +82,9 @@ public:
 
 protected:
 
+	int32 GetFirstSatisfiedChildNodeIndex(const UDlgContext& Context) const;
 	int32 GetRandomChildNodeIndex(UDlgContext& Context);
+	int32 GetWeightedRandomChildNodeIndex(UDlgContext& Context) const;
 
 protected:
 	// Defines the type of selector this node represents
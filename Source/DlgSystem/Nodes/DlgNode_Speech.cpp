@@ -5,6 +5,10 @@
 #include "DlgSystem/DlgConstants.h"
 #include "DlgSystem/Logging/DlgLogger.h"
 #include "DlgSystem/DlgLocalizationHelper.h"
+#include "DlgSystem/DlgHelper.h"
+#include "DlgSystem/DlgRuntimeStats.h"
+#include "Sound/SoundBase.h"
+#include "Sound/DialogueWave.h"
 
 
 void UDlgNode_Speech::OnCreatedInEditor()
@@ -47,6 +51,13 @@ void UDlgNode_Speech::UpdateTextsNamespacesAndKeys(const UDlgSystemSettings& Set
 	Super::UpdateTextsNamespacesAndKeys(Settings, bEdges, bUpdateGraphNode);
 }
 
+void UDlgNode_Speech::CompactRuntimeData(TMap<FString, FText>& SharedTexts)
+{
+	Super::CompactRuntimeData(SharedTexts);
+	TextArguments.Shrink();
+	FDlgLocalizationHelper::ShareText(Text, SharedTexts);
+}
+
 void UDlgNode_Speech::RebuildConstructedText(const UDlgContext& Context)
 {
 	if (TextArguments.Num() <= 0)
@@ -54,6 +65,7 @@ void UDlgNode_Speech::RebuildConstructedText(const UDlgContext& Context)
 		return;
 	}
 
+	FDlgScopedRuntimeTimer ScopedTimer(FDlgRuntimeStats::Get().GetTextFormatStats());
 	FFormatNamedArguments OrderedArguments;
 	for (const FDlgTextArgument& DlgArgument : TextArguments)
 	{
@@ -62,13 +74,57 @@ void UDlgNode_Speech::RebuildConstructedText(const UDlgContext& Context)
 	ConstructedText = FText::AsCultureInvariant(FText::Format(Text, OrderedArguments));
 }
 
-bool UDlgNode_Speech::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*> NodesEnteredWithThisStep)
+USoundBase* UDlgNode_Speech::GetNodeVoiceSoundBase() const
+{
+	return VoiceSoundWave ? VoiceSoundWave : SoftVoiceSoundWave.Get();
+}
+
+UDialogueWave* UDlgNode_Speech::GetNodeVoiceDialogueWave() const
+{
+	return VoiceDialogueWave ? VoiceDialogueWave : SoftVoiceDialogueWave.Get();
+}
+
+UObject* UDlgNode_Speech::GetNodeGenericData() const
+{
+	return GenericData ? GenericData : SoftGenericData.Get();
+}
+
+TSoftObjectPtr<USoundBase> UDlgNode_Speech::GetNodeSoftVoiceSoundBase() const
+{
+	return VoiceSoundWave ? TSoftObjectPtr<USoundBase>(VoiceSoundWave) : SoftVoiceSoundWave;
+}
+
+TSoftObjectPtr<UDialogueWave> UDlgNode_Speech::GetNodeSoftVoiceDialogueWave() const
+{
+	return VoiceDialogueWave ? TSoftObjectPtr<UDialogueWave>(VoiceDialogueWave) : SoftVoiceDialogueWave;
+}
+
+TSoftObjectPtr<UObject> UDlgNode_Speech::GetNodeSoftGenericData() const
 {
-	const bool bResult = Super::HandleNodeEnter(Context, NodesEnteredWithThisStep);
+	return GenericData ? TSoftObjectPtr<UObject>(GenericData) : SoftGenericData;
+}
+
+void UDlgNode_Speech::GetNodeSoftAssets(TArray<FSoftObjectPath>& OutAssetPaths) const
+{
+	FDlgHelper::AddSoftAssetPath(SoftVoiceSoundWave, OutAssetPaths);
+	FDlgHelper::AddSoftAssetPath(SoftVoiceDialogueWave, OutAssetPaths);
+	FDlgHelper::AddSoftAssetPath(SoftGenericData, OutAssetPaths);
+}
+
+void UDlgNode_Speech::ConvertNodeAssetReferences(bool bToSoftReferences)
+{
+	FDlgHelper::ConvertAssetReference(VoiceSoundWave, SoftVoiceSoundWave, bToSoftReferences);
+	FDlgHelper::ConvertAssetReference(VoiceDialogueWave, SoftVoiceDialogueWave, bToSoftReferences);
+	FDlgHelper::ConvertAssetReference(GenericData, SoftGenericData, bToSoftReferences);
+}
+
+bool UDlgNode_Speech::HandleNodeEnter(UDlgContext& Context)
+{
+	const bool bResult = Super::HandleNodeEnter(Context);
 	RebuildConstructedText(Context);
 
 	// Handle virtual parent enter events for direct children
-	if (bResult && bIsVirtualParent && Context.IsValidNodeIndex(VirtualParentFirstSatisfiedDirectChildIndex))
+	if (bResult && bIsVirtualParent && !Context.IsEvaluatingBark() && Context.IsValidNodeIndex(VirtualParentFirstSatisfiedDirectChildIndex))
 	{
 		// Add to history
 		Context.SetNodeVisited(
@@ -89,7 +145,7 @@ bool UDlgNode_Speech::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*
 	return bResult;
 }
 
-bool UDlgNode_Speech::ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNode*> AlreadyEvaluated)
+bool UDlgNode_Speech::ReevaluateChildren(UDlgContext& Context)
 {
 	if (bIsVirtualParent)
 	{
@@ -97,8 +153,14 @@ bool UDlgNode_Speech::ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNo
 		Context.GetMutableOptionsArray().Empty();
 		Context.GetAllMutableOptionsArray().Empty();
 
-		// stop endless loop
-		if (AlreadyEvaluated.Contains(this))
+		// stop endless loop, the nested virtual parents belong to the same step as the outermost one
+		FDlgNodeStepStamps& VirtualParentStamps = Context.GetVirtualParentStamps();
+		if (VirtualParentStamps.Depth == 0)
+		{
+			VirtualParentStamps.BeginStep();
+		}
+		const int32 NodeIndex = Context.GetNodeIndexForGUID(NodeGUID);
+		if (VirtualParentStamps.IsVisited(NodeIndex))
 		{
 			FDlgLogger::Get().Errorf(
 				TEXT("ReevaluateChildren - Endless loop detected, a virtual parent became his own parent! "
@@ -107,31 +169,39 @@ bool UDlgNode_Speech::ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNo
 			);
 			return false;
 		}
+		VirtualParentStamps.Visit(NodeIndex);
 
-		AlreadyEvaluated.Add(this);
-
-		for (const FDlgEdge& Edge : Children)
+		// Find first satisfied child
+		int32 ChildNodeIndex = INDEX_NONE;
 		{
-			// Find first satisfied child
-			if (Edge.Evaluate(Context, { this }))
+			const FDlgEvaluationPathScope PathScope(Context, this);
+			for (const FDlgEdge& Edge : Children)
 			{
-				if (UDlgNode* Node = Context.GetMutableNodeFromIndex(Edge.TargetIndex))
+				if (Edge.Evaluate(Context) && Context.GetNodeFromIndex(Edge.TargetIndex))
 				{
-					// Get Grandchildren
-					const bool bResult = Node->ReevaluateChildren(Context, AlreadyEvaluated);
-					if (bResult)
-					{
-						VirtualParentFirstSatisfiedDirectChildIndex = Edge.TargetIndex;
-					}
-					return bResult;
+					ChildNodeIndex = Edge.TargetIndex;
+					break;
 				}
 			}
 		}
+
+		if (UDlgNode* Node = Context.GetMutableNodeFromIndex(ChildNodeIndex))
+		{
+			// Get Grandchildren
+			VirtualParentStamps.Depth++;
+			const bool bResult = Node->ReevaluateChildren(Context);
+			VirtualParentStamps.Depth--;
+			if (bResult)
+			{
+				VirtualParentFirstSatisfiedDirectChildIndex = ChildNodeIndex;
+			}
+			return bResult;
+		}
 		return false;
 	}
 
 	// Normal speech node
-	return Super::ReevaluateChildren(Context, AlreadyEvaluated);
+	return Super::ReevaluateChildren(Context);
 }
 
 
@@ -46,13 +46,14 @@ public:
 	// Begin UDlgNode Interface.
 	//
 
-	bool HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*> NodesEnteredWithThisStep) override;
-	bool ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNode*> AlreadyEvaluated) override;
+	bool HandleNodeEnter(UDlgContext& Context) override;
+	bool ReevaluateChildren(UDlgContext& Context) override;
 	void GetAssociatedParticipants(TArray<FName>& OutArray) const override;
 
 	void UpdateTextsValuesFromDefaultsAndRemappings(const UDlgSystemSettings& Settings, bool bEdges, bool bUpdateGraphNode = true) override;
 	void UpdateTextsNamespacesAndKeys(const UDlgSystemSettings& Settings, bool bEdges, bool bUpdateGraphNode = true) override;
 	void RebuildConstructedText(const UDlgContext& Context) override;
+	void CompactRuntimeData(TMap<FString, FText>& SharedTexts) override;
 	void RebuildTextArguments(bool bEdges, bool bUpdateGraphNode = true) override
 	{
 		Super::RebuildTextArguments(bEdges, bUpdateGraphNode);
@@ -75,9 +76,15 @@ public:
 
 	// stuff we have to keep for legacy reason (but would make more sense to remove them from the plugin as they could be created in NodeData):
 	FName GetSpeakerState() const override { return SpeakerState; }
-	USoundBase* GetNodeVoiceSoundBase() const override { return VoiceSoundWave; }
-	UDialogueWave* GetNodeVoiceDialogueWave() const override { return VoiceDialogueWave; }
-	UObject* GetNodeGenericData() const override { return GenericData; }
+	USoundBase* GetNodeVoiceSoundBase() const override;
+	UDialogueWave* GetNodeVoiceDialogueWave() const override;
+	UObject* GetNodeGenericData() const override;
+
+	TSoftObjectPtr<USoundBase> GetNodeSoftVoiceSoundBase() const override;
+	TSoftObjectPtr<UDialogueWave> GetNodeSoftVoiceDialogueWave() const override;
+	TSoftObjectPtr<UObject> GetNodeSoftGenericData() const override;
+	void GetNodeSoftAssets(TArray<FSoftObjectPath>& OutAssetPaths) const override;
+	void ConvertNodeAssetReferences(bool bToSoftReferences) override;
 
 	void AddAllSpeakerStatesIntoSet(TSet<FName>& OutStates) const override { OutStates.Add(SpeakerState); }
 
@@ -108,6 +115,9 @@ public:
 	void SetVoiceSoundBase(USoundBase* InVoiceSoundBase) { VoiceSoundWave = InVoiceSoundBase; }
 	void SetVoiceDialogueWave(UDialogueWave* InVoiceDialogueWave) { VoiceDialogueWave = InVoiceDialogueWave; }
 	void SetGenericData(UObject* InGenericData) { GenericData = InGenericData; }
+	void SetSoftVoiceSoundBase(const TSoftObjectPtr<USoundBase>& InVoiceSoundBase) { SoftVoiceSoundWave = InVoiceSoundBase; }
+	void SetSoftVoiceDialogueWave(const TSoftObjectPtr<UDialogueWave>& InVoiceDialogueWave) { SoftVoiceDialogueWave = InVoiceDialogueWave; }
+	void SetSoftGenericData(const TSoftObjectPtr<UObject>& InGenericData) { SoftGenericData = InGenericData; }
 
 	// Helper functions to get the names of some properties. Used by the DlgSystemEditor module.
 	static FName GetMemberNameText() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Speech, Text); }
@@ -116,6 +126,9 @@ public:
 	static FName GetMemberNameVoiceSoundWave() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Speech, VoiceSoundWave); }
 	static FName GetMemberNameVoiceDialogueWave() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Speech, VoiceDialogueWave); }
 	static FName GetMemberNameGenericData() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Speech, GenericData); }
+	static FName GetMemberNameSoftVoiceSoundWave() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Speech, SoftVoiceSoundWave); }
+	static FName GetMemberNameSoftVoiceDialogueWave() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Speech, SoftVoiceDialogueWave); }
+	static FName GetMemberNameSoftGenericData() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Speech, SoftGenericData); }
 	static FName GetMemberNameSpeakerState() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Speech, SpeakerState); }
 	static FName GetMemberNameIsVirtualParent() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Speech, bIsVirtualParent); }
 	static FName GetMemberNameVirtualParentFireDirectChildEnterEvents() { return GET_MEMBER_NAME_CHECKED(UDlgNode_Speech, bVirtualParentFireDirectChildEnterEvents); }
@@ -168,6 +181,16 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Dialogue|Node", Meta = (DlgSaveOnlyReference))
 	UObject* GenericData = nullptr;
 
+	// Soft reference variants of the assets above, used instead of them if UDlgSystemSettings::bUseSoftReferencesForNodeAssets is true
+	UPROPERTY(EditAnywhere, Category = "Dialogue|Node", Meta = (DisplayName = "Voice Sound Wave"))
+	TSoftObjectPtr<USoundBase> SoftVoiceSoundWave;
+
+	UPROPERTY(EditAnywhere, Category = "Dialogue|Node", Meta = (DisplayName = "Voice Dialogue Wave"))
+	TSoftObjectPtr<UDialogueWave> SoftVoiceDialogueWave;
+
+	UPROPERTY(EditAnywhere, Category = "Dialogue|Node", Meta = (DisplayName = "Generic Data"))
+	TSoftObjectPtr<UObject> SoftGenericData;
+
 	// Constructed at runtime from the original text and the arguments if there is any.
 	FText ConstructedText;
 
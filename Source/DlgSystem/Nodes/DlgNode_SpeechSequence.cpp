@@ -3,8 +3,30 @@
 
 #include "DlgSystem/DlgContext.h"
 #include "DlgSystem/DlgLocalizationHelper.h"
+#include "DlgSystem/DlgHelper.h"
+#include "Sound/SoundBase.h"
+#include "Sound/DialogueWave.h"
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgSpeechSequenceEntry
+USoundBase* FDlgSpeechSequenceEntry::GetVoiceSoundBase() const
+{
+	return VoiceSoundWave ? VoiceSoundWave : SoftVoiceSoundWave.Get();
+}
+
+UDialogueWave* FDlgSpeechSequenceEntry::GetVoiceDialogueWave() const
+{
+	return VoiceDialogueWave ? VoiceDialogueWave : SoftVoiceDialogueWave.Get();
+}
+
+UObject* FDlgSpeechSequenceEntry::GetGenericData() const
+{
+	return GenericData ? GenericData : SoftGenericData.Get();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// UDlgNode_SpeechSequence
 #if WITH_EDITOR
 void UDlgNode_SpeechSequence::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -78,13 +100,45 @@ void UDlgNode_SpeechSequence::UpdateTextsNamespacesAndKeys(const UDlgSystemSetti
 	Super::UpdateTextsNamespacesAndKeys(Settings, bEdges, bUpdateGraphNode);
 }
 
-bool UDlgNode_SpeechSequence::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*> NodesEnteredWithThisStep)
+#if WITH_EDITOR
+bool UDlgNode_SpeechSequence::InternEdgeTextsIntoStringTable(UStringTable& StringTable, bool bUpdateGraphNode)
+{
+	bool bInterned = false;
+	for (FDlgSpeechSequenceEntry& Entry : SpeechSequence)
+	{
+		bInterned |= FDlgLocalizationHelper::InternTextIntoStringTable(StringTable, Entry.EdgeText);
+	}
+
+	// Super updates the graph node
+	return Super::InternEdgeTextsIntoStringTable(StringTable, bUpdateGraphNode) || bInterned;
+}
+#endif
+
+void UDlgNode_SpeechSequence::CompactRuntimeData(TMap<FString, FText>& SharedTexts)
+{
+	Super::CompactRuntimeData(SharedTexts);
+
+	SpeechSequence.Shrink();
+	for (FDlgSpeechSequenceEntry& Entry : SpeechSequence)
+	{
+		FDlgLocalizationHelper::ShareText(Entry.Text, SharedTexts);
+		FDlgLocalizationHelper::ShareText(Entry.EdgeText, SharedTexts);
+	}
+
+	InnerEdges.Shrink();
+	for (FDlgEdge& Edge : InnerEdges)
+	{
+		Edge.CompactRuntimeData(SharedTexts);
+	}
+}
+
+bool UDlgNode_SpeechSequence::HandleNodeEnter(UDlgContext& Context)
 {
 	ActualIndex = 0;
-	return Super::HandleNodeEnter(Context, NodesEnteredWithThisStep);
+	return Super::HandleNodeEnter(Context);
 }
 
-bool UDlgNode_SpeechSequence::ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNode*> AlreadyEvaluated)
+bool UDlgNode_SpeechSequence::ReevaluateChildren(UDlgContext& Context)
 {
 	TArray<FDlgEdge>& Options = Context.GetMutableOptionsArray();
 	TArray<FDlgEdgeData>& AllOptions = Context.GetAllMutableOptionsArray();
@@ -93,7 +147,7 @@ bool UDlgNode_SpeechSequence::ReevaluateChildren(UDlgContext& Context, TSet<cons
 
 	// If the last entry is active the real edges are used
 	if (ActualIndex == SpeechSequence.Num() - 1)
-		return Super::ReevaluateChildren(Context, AlreadyEvaluated);
+		return Super::ReevaluateChildren(Context);
 
 	// give the context the fake inner edge
 	if (InnerEdges.IsValidIndex(ActualIndex))
@@ -112,12 +166,12 @@ bool UDlgNode_SpeechSequence::OptionSelected(int32 OptionIndex, bool bFromAll, U
 	if (ActualIndex >= 0 && ActualIndex < SpeechSequence.Num() - 1)
 	{
 		ActualIndex += 1;
-		return ReevaluateChildren(Context, {this});
+		return Context.ReevaluateNodeChildren(*this);
 	}
 
 	// node finished -> generate true children
 	ActualIndex = 0;
-	Super::ReevaluateChildren(Context, { this });
+	Super::ReevaluateChildren(Context);
 	return Super::OptionSelected(OptionIndex, bFromAll, Context);
 }
 
@@ -127,12 +181,12 @@ bool UDlgNode_SpeechSequence::OptionSelectedFromReplicated(int32 OptionIndex, bo
 	if (SpeechSequence.IsValidIndex(OptionIndex))
 	{
 		ActualIndex = OptionIndex;
-		return ReevaluateChildren(Context, { this });
+		return Context.ReevaluateNodeChildren(*this);
 	}
 
 	// node finished -> generate true children
 	ActualIndex = 0;
-	Super::ReevaluateChildren(Context, { this });
+	Super::ReevaluateChildren(Context);
 	return Super::OptionSelected(OptionIndex, bFromAll, Context);
 }
 
@@ -160,7 +214,7 @@ USoundBase* UDlgNode_SpeechSequence::GetNodeVoiceSoundBase() const
 {
 	if (SpeechSequence.IsValidIndex(ActualIndex))
 	{
-		return SpeechSequence[ActualIndex].VoiceSoundWave;
+		return SpeechSequence[ActualIndex].GetVoiceSoundBase();
 	}
 
 	return nullptr;
@@ -170,7 +224,7 @@ UDialogueWave* UDlgNode_SpeechSequence::GetNodeVoiceDialogueWave() const
 {
 	if (SpeechSequence.IsValidIndex(ActualIndex))
 	{
-		return SpeechSequence[ActualIndex].VoiceDialogueWave;
+		return SpeechSequence[ActualIndex].GetVoiceDialogueWave();
 	}
 
 	return nullptr;
@@ -180,12 +234,66 @@ UObject* UDlgNode_SpeechSequence::GetNodeGenericData() const
 {
 	if (SpeechSequence.IsValidIndex(ActualIndex))
 	{
-		return SpeechSequence[ActualIndex].GenericData;
+		return SpeechSequence[ActualIndex].GetGenericData();
+	}
+
+	return nullptr;
+}
+
+TSoftObjectPtr<USoundBase> UDlgNode_SpeechSequence::GetNodeSoftVoiceSoundBase() const
+{
+	if (SpeechSequence.IsValidIndex(ActualIndex))
+	{
+		const FDlgSpeechSequenceEntry& Entry = SpeechSequence[ActualIndex];
+		return Entry.VoiceSoundWave ? TSoftObjectPtr<USoundBase>(Entry.VoiceSoundWave) : Entry.SoftVoiceSoundWave;
+	}
+
+	return nullptr;
+}
+
+TSoftObjectPtr<UDialogueWave> UDlgNode_SpeechSequence::GetNodeSoftVoiceDialogueWave() const
+{
+	if (SpeechSequence.IsValidIndex(ActualIndex))
+	{
+		const FDlgSpeechSequenceEntry& Entry = SpeechSequence[ActualIndex];
+		return Entry.VoiceDialogueWave ? TSoftObjectPtr<UDialogueWave>(Entry.VoiceDialogueWave) : Entry.SoftVoiceDialogueWave;
+	}
+
+	return nullptr;
+}
+
+TSoftObjectPtr<UObject> UDlgNode_SpeechSequence::GetNodeSoftGenericData() const
+{
+	if (SpeechSequence.IsValidIndex(ActualIndex))
+	{
+		const FDlgSpeechSequenceEntry& Entry = SpeechSequence[ActualIndex];
+		return Entry.GenericData ? TSoftObjectPtr<UObject>(Entry.GenericData) : Entry.SoftGenericData;
 	}
 
 	return nullptr;
 }
 
+void UDlgNode_SpeechSequence::GetNodeSoftAssets(TArray<FSoftObjectPath>& OutAssetPaths) const
+{
+	// The node stays active for the whole sequence
+	for (const FDlgSpeechSequenceEntry& Entry : SpeechSequence)
+	{
+		FDlgHelper::AddSoftAssetPath(Entry.SoftVoiceSoundWave, OutAssetPaths);
+		FDlgHelper::AddSoftAssetPath(Entry.SoftVoiceDialogueWave, OutAssetPaths);
+		FDlgHelper::AddSoftAssetPath(Entry.SoftGenericData, OutAssetPaths);
+	}
+}
+
+void UDlgNode_SpeechSequence::ConvertNodeAssetReferences(bool bToSoftReferences)
+{
+	for (FDlgSpeechSequenceEntry& Entry : SpeechSequence)
+	{
+		FDlgHelper::ConvertAssetReference(Entry.VoiceSoundWave, Entry.SoftVoiceSoundWave, bToSoftReferences);
+		FDlgHelper::ConvertAssetReference(Entry.VoiceDialogueWave, Entry.SoftVoiceDialogueWave, bToSoftReferences);
+		FDlgHelper::ConvertAssetReference(Entry.GenericData, Entry.SoftGenericData, bToSoftReferences);
+	}
+}
+
 FName UDlgNode_SpeechSequence::GetSpeakerState() const
 {
 	if (SpeechSequence.IsValidIndex(ActualIndex))
@@ -50,6 +50,22 @@ public:
 	// NOTE: You should probably use the NodeData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue|Node", Meta = (DlgSaveOnlyReference))
 	UObject* GenericData = nullptr;
+
+	// Soft reference variants of the assets above, used instead of them if UDlgSystemSettings::bUseSoftReferencesForNodeAssets is true
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue|Node", Meta = (DisplayName = "Voice Sound Wave"))
+	TSoftObjectPtr<USoundBase> SoftVoiceSoundWave;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue|Node", Meta = (DisplayName = "Voice Dialogue Wave"))
+	TSoftObjectPtr<UDialogueWave> SoftVoiceDialogueWave;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue|Node", Meta = (DisplayName = "Generic Data"))
+	TSoftObjectPtr<UObject> SoftGenericData;
+
+public:
+	// The hard reference if set, otherwise the soft reference if it is loaded
+	USoundBase* GetVoiceSoundBase() const;
+	UDialogueWave* GetVoiceDialogueWave() const;
+	UObject* GetGenericData() const;
 };
 
 
@@ -76,8 +92,12 @@ public:
 	// Begin UDlgNode interface
 	void UpdateTextsValuesFromDefaultsAndRemappings(const UDlgSystemSettings& Settings, bool bEdges, bool bUpdateGraphNode = true) override;
 	void UpdateTextsNamespacesAndKeys(const UDlgSystemSettings& Settings, bool bEdges, bool bUpdateGraphNode = true) override;
-	bool HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*> NodesEnteredWithThisStep) override;
-	bool ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNode*> AlreadyEvaluated) override;
+#if WITH_EDITOR
+	bool InternEdgeTextsIntoStringTable(UStringTable& StringTable, bool bUpdateGraphNode = true) override;
+#endif
+	void CompactRuntimeData(TMap<FString, FText>& SharedTexts) override;
+	bool HandleNodeEnter(UDlgContext& Context) override;
+	bool ReevaluateChildren(UDlgContext& Context) override;
 	bool OptionSelected(int32 OptionIndex, bool bFromAll, UDlgContext& Context) override;
 
 	// Getters
@@ -88,6 +108,11 @@ public:
 	FName GetSpeakerState() const override;
 	void AddAllSpeakerStatesIntoSet(TSet<FName>& OutStates) const override;
 	UObject* GetNodeGenericData() const override;
+	TSoftObjectPtr<USoundBase> GetNodeSoftVoiceSoundBase() const override;
+	TSoftObjectPtr<UDialogueWave> GetNodeSoftVoiceDialogueWave() const override;
+	TSoftObjectPtr<UObject> GetNodeSoftGenericData() const override;
+	void GetNodeSoftAssets(TArray<FSoftObjectPath>& OutAssetPaths) const override;
+	void ConvertNodeAssetReferences(bool bToSoftReferences) override;
 	FName GetNodeParticipantName() const override;
 	void GetAssociatedParticipants(TArray<FName>& OutArray) const override;
 
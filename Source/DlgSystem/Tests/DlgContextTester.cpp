@@ -0,0 +1,51 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+
+#include "DlgSystem/DlgContext.h"
+#include "DlgSystem/DlgMemory.h"
+#include "DlgContextTesterTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgContextBarkAutomationTest,
+	"DlgSystem.Context.Bark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FDlgContextBarkAutomationTest::RunTest(const FString& Parameters)
+{
+	// The selector writes into the global memory, do not leave anything behind
+	const TMap<FGuid, FDlgHistory> OriginalHistory = FDlgMemory::Get().GetHistoryMapsCopy();
+
+	UDlgDialogue* Dialogue = FDlgContextTesterHelper::CreateSelectorDialogue(4, EDlgNodeSelectorType::Random);
+	UDlgTestParticipant* Participant = FDlgContextTesterHelper::CreateParticipant();
+
+	// Same as the bark context of the UDlgSchedulerSubsystem, shared by all the barks
+	UDlgContext* BarkContext = NewObject<UDlgContext>(GetTransientPackage());
+
+	FDlgBarkResult Result;
+	TestTrue(TEXT("Bark: first bark enters a node"), BarkContext->EvaluateBark(Dialogue, Participant, false, Result));
+
+	// Repeated barks on the shared context do not allocate a context
+	const int32 NumContexts = FDlgContextTesterHelper::CountContexts();
+	for (int32 BarkIndex = 0; BarkIndex < 100; BarkIndex++)
+	{
+		BarkContext->SetRandomSeed(BarkIndex + 1);
+		if (!BarkContext->EvaluateBark(Dialogue, Participant, false, Result))
+		{
+			AddError(FString::Printf(TEXT("Bark: bark %d did not enter a node"), BarkIndex));
+			break;
+		}
+	}
+	TestEqual(TEXT("Bark: repeated barks do not allocate a context"), FDlgContextTesterHelper::CountContexts(), NumContexts);
+	TestFalse(TEXT("Bark: the shared context is not left evaluating"), BarkContext->IsEvaluatingBark());
+	TestTrue(TEXT("Bark: the shared context does not keep the Dialogue alive"), BarkContext->GetDialogue() == nullptr);
+
+	FDlgMemory::Get().SetHistoryMap(OriginalHistory);
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,57 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgContextTesterTypes.h"
+
+#include "UObject/UObjectIterator.h"
+
+#include "DlgSystem/DlgContext.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/Nodes/DlgNode_Speech.h"
+#include "DlgSystem/Nodes/DlgNode_Start.h"
+
+const FName UDlgTestParticipant::ParticipantName(TEXT("TestParticipant"));
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgContextTesterHelper
+UDlgDialogue* FDlgContextTesterHelper::CreateSelectorDialogue(
+	int32 NumChildren,
+	EDlgNodeSelectorType SelectorType,
+	bool bAvoidPickingSameOptionTwiceInARow,
+	bool bCycleThroughSatisfiedOptionsWithoutRepetition
+)
+{
+	UDlgDialogue* Dialogue = NewObject<UDlgDialogue>(GetTransientPackage(), NAME_None, RF_Transient);
+	Dialogue->RegenerateGUID();
+
+	UDlgNode_Selector* Selector = NewObject<UDlgNode_Selector>(Dialogue);
+	Selector->RegenerateGUID();
+	Selector->SetSelectorType(SelectorType);
+	Selector->SetAvoidPickingSameOptionTwiceInARow(bAvoidPickingSameOptionTwiceInARow);
+	Selector->SetCycleThroughSatisfiedOptionsWithoutRepetition(bCycleThroughSatisfiedOptionsWithoutRepetition);
+
+	TArray<UDlgNode*> Nodes = { Selector };
+	for (int32 ChildIndex = 0; ChildIndex < NumChildren; ChildIndex++)
+	{
+		UDlgNode_Speech* Speech = NewObject<UDlgNode_Speech>(Dialogue);
+		Speech->RegenerateGUID();
+		Speech->SetNodeParticipantName(UDlgTestParticipant::ParticipantName);
+		Selector->AddNodeChild(FDlgEdge(Nodes.Add(Speech)));
+	}
+	Dialogue->SetNodes(Nodes);
+
+	UDlgNode_Start* StartNode = NewObject<UDlgNode_Start>(Dialogue);
+	StartNode->RegenerateGUID();
+	StartNode->AddNodeChild(FDlgEdge(0));
+	Dialogue->SetStartNodes({ StartNode });
+
+	return Dialogue;
+}
+
+int32 FDlgContextTesterHelper::CountContexts()
+{
+	int32 NumContexts = 0;
+	for (TObjectIterator<UDlgContext> Itr; Itr; ++Itr)
+	{
+		NumContexts++;
+	}
+	return NumContexts;
+}
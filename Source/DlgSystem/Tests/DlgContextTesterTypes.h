@@ -0,0 +1,60 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Package.h"
+
+#include "DlgSystem/DlgDialogueParticipant.h"
+#include "DlgSystem/Nodes/DlgNode_Selector.h"
+
+#include "DlgContextTesterTypes.generated.h"
+
+class UDlgDialogue;
+
+
+// Participant of the Dialogues created by the tests, every condition is satisfied
+UCLASS()
+class UDlgTestParticipant : public UObject, public IDlgDialogueParticipant
+{
+	GENERATED_BODY()
+
+public:
+	//~ IDlgDialogueParticipant interface
+	FName GetParticipantName_Implementation() const override { return ParticipantName; }
+	FText GetParticipantDisplayName_Implementation(FName ActiveSpeaker) const override { return FText::FromName(ParticipantName); }
+	ETextGender GetParticipantGender_Implementation() const override { return ETextGender::Neuter; }
+	UTexture2D* GetParticipantIcon_Implementation(FName ActiveSpeaker, FName ActiveSpeakerState) const override { return nullptr; }
+
+	bool CheckCondition_Implementation(const UDlgContext* Context, FName ConditionName) const override { return true; }
+	float GetFloatValue_Implementation(FName ValueName) const override { return 0.f; }
+	int32 GetIntValue_Implementation(FName ValueName) const override { return 0; }
+	bool GetBoolValue_Implementation(FName ValueName) const override { return false; }
+	FName GetNameValue_Implementation(FName ValueName) const override { return NAME_None; }
+
+	bool OnDialogueEvent_Implementation(UDlgContext* Context, FName EventName) override { return false; }
+	bool ModifyFloatValue_Implementation(FName ValueName, bool bDelta, float Value) override { return false; }
+	bool ModifyIntValue_Implementation(FName ValueName, bool bDelta, int32 Value) override { return false; }
+	bool ModifyBoolValue_Implementation(FName ValueName, bool bNewValue) override { return false; }
+	bool ModifyNameValue_Implementation(FName ValueName, FName NameValue) override { return false; }
+
+public:
+	static const FName ParticipantName;
+};
+
+
+class FDlgContextTesterHelper
+{
+public:
+	// Start Node -> Selector (Node 0) -> NumChildren Speech Nodes (Nodes 1..NumChildren)
+	static UDlgDialogue* CreateSelectorDialogue(
+		int32 NumChildren,
+		EDlgNodeSelectorType SelectorType,
+		bool bAvoidPickingSameOptionTwiceInARow = false,
+		bool bCycleThroughSatisfiedOptionsWithoutRepetition = false
+	);
+
+	static UDlgTestParticipant* CreateParticipant() { return NewObject<UDlgTestParticipant>(GetTransientPackage()); }
+
+	// Number of the UDlgContext objects alive (or not yet collected)
+	static int32 CountContexts();
+};
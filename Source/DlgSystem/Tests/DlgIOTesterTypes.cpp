@@ -230,6 +230,8 @@ void FDlgTestStructPrimitives::GenerateRandomData(const FDlgIOTesterOptions& InO
 	};
 	Texture2DReference = TexturesPool[FMath::RandHelper(TexturesPool.Num())];
 	ConstTexture2D = GEngine->DefaultTexture;
+	SoftTexture2D = TexturesPool[FMath::RandHelper(TexturesPool.Num())];
+	EmptySoftObject.Reset();
 
 	ObjectPrimitivesBase = NewObject<UDlgTestObjectPrimitivesBase>();
 	ObjectPrimitivesBase->GenerateRandomData(Options);
@@ -421,6 +423,18 @@ bool FDlgTestStructPrimitives::IsEqual(const Self& Other, FString& OutError) con
 		OutError += FString::Printf(TEXT("\tThis.Texture2D (%s) != Other.Texture2D (%s)\n"), *FDlgHelper::GetFullNameFromObject(Texture2DReference), *FDlgHelper::GetFullNameFromObject(Other.Texture2DReference));
 	}
 
+	if (SoftTexture2D != Other.SoftTexture2D)
+	{
+		bIsEqual = false;
+		OutError += FString::Printf(TEXT("\tThis.SoftTexture2D (%s) != Other.SoftTexture2D (%s)\n"), *SoftTexture2D.ToString(), *Other.SoftTexture2D.ToString());
+	}
+
+	if (!Other.EmptySoftObject.IsNull())
+	{
+		bIsEqual = false;
+		OutError += FString::Printf(TEXT("\tOther.EmptySoftObject (%s) is not null\n"), *Other.EmptySoftObject.ToString());
+	}
+
 	if (!ObjectPrimitivesBase->IsEqual(Other.ObjectPrimitivesBase, OutError))
 	{
 		bIsEqual = false;
@@ -504,6 +518,8 @@ void FDlgTestStructPrimitives::SetToDefaults()
 	EmptyObjectInitializedReference = nullptr;
 	Texture2DReference = nullptr;
 	ConstTexture2D = nullptr;
+	SoftTexture2D.Reset();
+	EmptySoftObject.Reset();
 	ObjectPrimitivesBase = nullptr;
 	ObjectDefaultToInstanced = nullptr;
 	ObjectPrimitivesChildA = nullptr;
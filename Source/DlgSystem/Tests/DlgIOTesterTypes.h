@@ -318,6 +318,13 @@ public:
 	UPROPERTY(meta=(DlgSaveOnlyReference))
 	UTexture2D* Texture2DReference;
 
+	// Soft references are written as their path, they must survive the round trip without being loaded
+	UPROPERTY()
+	TSoftObjectPtr<UTexture2D> SoftTexture2D;
+
+	UPROPERTY()
+	TSoftObjectPtr<UObject> EmptySoftObject;
+
 	UPROPERTY()
 	UDlgTestObjectPrimitivesBase* ObjectPrimitivesBase;
 
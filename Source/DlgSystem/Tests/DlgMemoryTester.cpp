@@ -0,0 +1,221 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include "DlgSystem/DlgContext.h"
+#include "DlgSystem/DlgMemory.h"
+#include "DlgSystem/IO/DlgJsonParser.h"
+#include "DlgSystem/IO/DlgJsonWriter.h"
+#include "DlgContextTesterTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FDlgMemoryTester
+{
+public:
+	static bool IsEqual(const FDlgNodeSavedData& A, const FDlgNodeSavedData& B)
+	{
+		return A.GUIDList == B.GUIDList
+			&& A.UsedEdgesMask == B.UsedEdgesMask
+			&& A.NumEdges == B.NumEdges
+			&& A.LastEdgeIndex == B.LastEdgeIndex;
+	}
+
+	// 40 edges, so the mask needs more than one word
+	static FDlgNodeSavedData MakeSavedData()
+	{
+		FDlgNodeSavedData SavedData;
+		SavedData.InitUsedEdges(40);
+		SavedData.SetEdgeUsed(1);
+		SavedData.SetEdgeUsed(33);
+		SavedData.LastEdgeIndex = 33;
+		return SavedData;
+	}
+
+	// The edge index picked by the selector (Node 0) of each bark, INDEX_NONE if a bark failed
+	static TArray<int32> PickEdges(UDlgContext& Context, UDlgDialogue* Dialogue, UObject* Participant, int32 NumPicks)
+	{
+		TArray<int32> EdgeIndices;
+		for (int32 PickIndex = 0; PickIndex < NumPicks; PickIndex++)
+		{
+			FDlgBarkResult Result;
+			EdgeIndices.Add(Context.EvaluateBark(Dialogue, Participant, false, Result) ? Result.NodeIndex - 1 : INDEX_NONE);
+		}
+		return EdgeIndices;
+	}
+
+	// Does every block of NumEdges picks contain each edge exactly once?
+	static bool IsEachCycleComplete(const TArray<int32>& EdgeIndices, int32 NumEdges)
+	{
+		for (int32 CycleStart = 0; CycleStart + NumEdges <= EdgeIndices.Num(); CycleStart += NumEdges)
+		{
+			TBitArray<> Picked(false, NumEdges);
+			for (int32 Index = CycleStart; Index < CycleStart + NumEdges; Index++)
+			{
+				const int32 EdgeIndex = EdgeIndices[Index];
+				if (!Picked.IsValidIndex(EdgeIndex) || Picked[EdgeIndex])
+				{
+					return false;
+				}
+				Picked[EdgeIndex] = true;
+			}
+		}
+		return true;
+	}
+
+	static bool HasSamePickTwiceInARow(const TArray<int32>& EdgeIndices)
+	{
+		for (int32 Index = 1; Index < EdgeIndices.Num(); Index++)
+		{
+			if (EdgeIndices[Index] == EdgeIndices[Index - 1])
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+// NOTE: to run this test, first remove the EAutomationTestFlags::Disabled flag
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgMemoryAutomationTest,
+	"DlgSystem.Memory.Tests",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FDlgMemoryAutomationTest::RunTest(const FString& Parameters)
+{
+	// Old saves: GUIDList -> UsedEdgesMask
+	{
+		TArray<FGuid> EdgeTargetGUIDs;
+		for (int32 Index = 0; Index < 4; Index++)
+		{
+			EdgeTargetGUIDs.Add(FGuid::NewGuid());
+		}
+
+		FDlgNodeSavedData SavedData;
+		SavedData.GUIDList = { EdgeTargetGUIDs[3], EdgeTargetGUIDs[1] };
+		SavedData.ConvertGUIDListToUsedEdges(EdgeTargetGUIDs);
+
+		TestEqual(TEXT("Migration: GUIDList is emptied"), SavedData.GUIDList.Num(), 0);
+		TestEqual(TEXT("Migration: mask sized for the edges"), SavedData.UsedEdgesMask.Num(), 1);
+		TestEqual(TEXT("Migration: NumEdges"), SavedData.NumEdges, 4);
+		TestFalse(TEXT("Migration: edge 0 not used"), SavedData.IsEdgeUsed(0));
+		TestTrue(TEXT("Migration: edge 1 used"), SavedData.IsEdgeUsed(1));
+		TestFalse(TEXT("Migration: edge 2 not used"), SavedData.IsEdgeUsed(2));
+		TestTrue(TEXT("Migration: edge 3 used"), SavedData.IsEdgeUsed(3));
+		TestEqual(TEXT("Migration: LastEdgeIndex is the last GUID"), SavedData.LastEdgeIndex, 1);
+	}
+
+	// The picks are forgotten once the number of edges changes
+	{
+		FDlgNodeSavedData SavedData = FDlgMemoryTester::MakeSavedData();
+		TestEqual(TEXT("InitUsedEdges: mask sized once"), SavedData.UsedEdgesMask.Num(), 2);
+		TestFalse(TEXT("InitUsedEdges: same number of edges keeps the picks"), SavedData.InitUsedEdges(40));
+		TestTrue(TEXT("InitUsedEdges: edge 33 still used"), SavedData.IsEdgeUsed(33));
+
+		TestTrue(TEXT("InitUsedEdges: new number of edges resets the picks"), SavedData.InitUsedEdges(3));
+		TestFalse(TEXT("InitUsedEdges: edge 1 not used anymore"), SavedData.IsEdgeUsed(1));
+		TestEqual(TEXT("InitUsedEdges: LastEdgeIndex reset"), SavedData.LastEdgeIndex, static_cast<int32>(INDEX_NONE));
+		TestEqual(TEXT("InitUsedEdges: mask resized"), SavedData.UsedEdgesMask.Num(), 1);
+	}
+
+	// Save games, tagged property serialization
+	{
+		FDlgNodeSavedData Exported = FDlgMemoryTester::MakeSavedData();
+		FDlgNodeSavedData Imported;
+
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		FDlgNodeSavedData::StaticStruct()->SerializeItem(Writer, &Exported, nullptr);
+
+		FMemoryReader Reader(Bytes);
+		FDlgNodeSavedData::StaticStruct()->SerializeItem(Reader, &Imported, nullptr);
+		TestTrue(TEXT("Archive round trip"), FDlgMemoryTester::IsEqual(Exported, Imported));
+	}
+
+	// Text files
+	{
+		FDlgNodeSavedData Exported = FDlgMemoryTester::MakeSavedData();
+		FDlgNodeSavedData Imported;
+
+		FDlgJsonWriter Writer;
+		Writer.Write(FDlgNodeSavedData::StaticStruct(), &Exported);
+
+		FDlgJsonParser Parser;
+		Parser.InitializeParserFromString(Writer.GetAsString());
+		Parser.ReadAllProperty(FDlgNodeSavedData::StaticStruct(), &Imported);
+		TestTrue(TEXT("JSON round trip"), FDlgMemoryTester::IsEqual(Exported, Imported));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgMemorySelectorAutomationTest,
+	"DlgSystem.Memory.Selector",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FDlgMemorySelectorAutomationTest::RunTest(const FString& Parameters)
+{
+	// The selectors write into the global memory, do not leave anything behind
+	const TMap<FGuid, FDlgHistory> OriginalHistory = FDlgMemory::Get().GetHistoryMapsCopy();
+	UDlgTestParticipant* Participant = FDlgContextTesterHelper::CreateParticipant();
+
+	// Same seed, same picks
+	{
+		UDlgDialogue* Dialogue = FDlgContextTesterHelper::CreateSelectorDialogue(8, EDlgNodeSelectorType::Random);
+		UDlgContext* ContextA = NewObject<UDlgContext>(GetTransientPackage());
+		UDlgContext* ContextB = NewObject<UDlgContext>(GetTransientPackage());
+		ContextA->SetRandomSeed(1234);
+		ContextB->SetRandomSeed(1234);
+
+		const TArray<int32> PicksA = FDlgMemoryTester::PickEdges(*ContextA, Dialogue, Participant, 32);
+		const TArray<int32> PicksB = FDlgMemoryTester::PickEdges(*ContextB, Dialogue, Participant, 32);
+		TestFalse(TEXT("Seed: every bark picks an edge"), PicksA.Contains(INDEX_NONE));
+		TestTrue(TEXT("Seed: same seed picks the same sequence"), PicksA == PicksB);
+	}
+
+	// Cycle without repetition
+	{
+		constexpr int32 NumEdges = 5;
+		UDlgDialogue* Dialogue = FDlgContextTesterHelper::CreateSelectorDialogue(NumEdges, EDlgNodeSelectorType::Random, false, true);
+		UDlgContext* Context = NewObject<UDlgContext>(GetTransientPackage());
+		Context->SetRandomSeed(42);
+
+		const TArray<int32> Picks = FDlgMemoryTester::PickEdges(*Context, Dialogue, Participant, NumEdges * 4);
+		TestTrue(TEXT("Cycle: no repeats inside a cycle"), FDlgMemoryTester::IsEachCycleComplete(Picks, NumEdges));
+	}
+
+	// Avoid picking the same option twice in a row
+	{
+		UDlgDialogue* Dialogue = FDlgContextTesterHelper::CreateSelectorDialogue(3, EDlgNodeSelectorType::Random, true, false);
+		UDlgContext* Context = NewObject<UDlgContext>(GetTransientPackage());
+		Context->SetRandomSeed(7);
+
+		const TArray<int32> Picks = FDlgMemoryTester::PickEdges(*Context, Dialogue, Participant, 64);
+		TestFalse(TEXT("Avoid: every bark picks an edge"), Picks.Contains(INDEX_NONE));
+		TestFalse(TEXT("Avoid: never the same option twice in a row"), FDlgMemoryTester::HasSamePickTwiceInARow(Picks));
+	}
+
+	// Both, 40 edges so the used edges mask needs more than one word, the last pick is blocked when a cycle restarts
+	{
+		constexpr int32 NumEdges = 40;
+		UDlgDialogue* Dialogue = FDlgContextTesterHelper::CreateSelectorDialogue(NumEdges, EDlgNodeSelectorType::Random, true, true);
+		UDlgContext* Context = NewObject<UDlgContext>(GetTransientPackage());
+		Context->SetRandomSeed(99);
+
+		const TArray<int32> Picks = FDlgMemoryTester::PickEdges(*Context, Dialogue, Participant, NumEdges * 3);
+		TestTrue(TEXT("Cycle and avoid: no repeats inside a cycle"), FDlgMemoryTester::IsEachCycleComplete(Picks, NumEdges));
+		TestFalse(TEXT("Cycle and avoid: no repeat across the cycles"), FDlgMemoryTester::HasSamePickTwiceInARow(Picks));
+	}
+
+	FDlgMemory::Get().SetHistoryMap(OriginalHistory);
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
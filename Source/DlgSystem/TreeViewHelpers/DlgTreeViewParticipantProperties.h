@@ -51,6 +51,25 @@ public:
 	// Add Dialogue that containt this participant.
 	void AddDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue) { Dialogues.Add(Dialogue); }
 
+	// Removes the Dialogue from this participant and all its variables, the variables only used by this Dialogue are removed
+	void RemoveDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue, const FGuid& DialogueGUID)
+	{
+		Dialogues.Remove(Dialogue);
+		RemoveDialogueFromVariables(Events, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(UnrealFunctions, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(CustomEvents, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(Conditions, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(Integers, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(Floats, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(Bools, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(FNames, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(ClassIntegers, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(ClassFloats, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(ClassBools, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(ClassFNames, Dialogue, DialogueGUID);
+		RemoveDialogueFromVariables(ClassFTexts, Dialogue, DialogueGUID);
+	}
+
 	// Returns the EventName Property
 	TSharedPtr<VariablePropertyType> AddDialogueToEvent(FName EventName, TWeakObjectPtr<const UDlgDialogue> Dialogue)
 	{
@@ -199,6 +218,23 @@ protected:
 		return VariableProps;
 	}
 
+	template <typename KeyType>
+	static void RemoveDialogueFromVariables(
+		TMap<KeyType, TSharedPtr<VariablePropertyType>>& VariableMap,
+		TWeakObjectPtr<const UDlgDialogue> Dialogue,
+		const FGuid& DialogueGUID
+	)
+	{
+		for (auto It = VariableMap.CreateIterator(); It; ++It)
+		{
+			It.Value()->RemoveDialogue(Dialogue, DialogueGUID);
+			if (It.Value()->GetDialogues().Num() == 0)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
 protected:
 	/**
 	 * Dialogues that contain this participant
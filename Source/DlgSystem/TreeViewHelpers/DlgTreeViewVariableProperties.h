@@ -17,6 +17,9 @@ public:
 
 	// Dialogues:
 	virtual void AddDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue) { Dialogues.Add(Dialogue); }
+
+	// The GUID is the one the Dialogue had when it was added, the Dialogue might be already destroyed
+	virtual void RemoveDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue, const FGuid& DialogueGUID) { Dialogues.Remove(Dialogue); }
 	const TSet<TWeakObjectPtr<const UDlgDialogue>>& GetDialogues() const { return Dialogues; }
 
 	/** Sorts all the properties it can */
@@ -1,6 +1,8 @@
 // Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
 #include "DlgBrowserTreeVariableProperties.h"
 
+#include "DlgSystemEditor/Search/DlgSearchUtilities.h"
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FDialogueTreeVariableProperties
 FDlgBrowserTreeVariableProperties::FDlgBrowserTreeVariableProperties(const TSet<TWeakObjectPtr<const UDlgDialogue>>& InDialogues)
@@ -46,3 +48,38 @@ void FDlgBrowserTreeVariableProperties::AddDialogue(TWeakObjectPtr<const UDlgDia
 		}
 	}
 }
+
+void FDlgBrowserTreeVariableProperties::RemoveDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue, const FGuid& DialogueGUID)
+{
+	Super::RemoveDialogue(Dialogue, DialogueGUID);
+	GraphNodes.Remove(DialogueGUID);
+	EdgeNodes.Remove(DialogueGUID);
+	PendingGraphNodesSearches.Remove(DialogueGUID);
+}
+
+void FDlgBrowserTreeVariableProperties::ResolveGraphNodesSearches(const UDlgDialogue* Dialogue)
+{
+	if (!Dialogue)
+	{
+		return;
+	}
+
+	const FGuid ID = Dialogue->GetGUID();
+	TArray<FDlgBrowserGraphNodesSearch> Searches;
+	if (!PendingGraphNodesSearches.RemoveAndCopyValue(ID, Searches))
+	{
+		return;
+	}
+
+	TSet<TWeakObjectPtr<const UDialogueGraphNode>>& GraphNodesSet = GraphNodes.FindOrAdd(ID);
+	TSet<TWeakObjectPtr<const UDialogueGraphNode_Edge>>& EdgeNodesSet = EdgeNodes.FindOrAdd(ID);
+	for (const FDlgBrowserGraphNodesSearch& Search : Searches)
+	{
+		const TSharedPtr<FDlgSearchFoundResult> SearchResult = Search(Dialogue);
+		if (SearchResult.IsValid())
+		{
+			GraphNodesSet.Append(SearchResult->GraphNodes);
+			EdgeNodesSet.Append(SearchResult->EdgeNodes);
+		}
+	}
+}
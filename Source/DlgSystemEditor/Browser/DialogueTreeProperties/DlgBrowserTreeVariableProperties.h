@@ -10,6 +10,10 @@ class UDialogueGraphNode;
 class UDialogueGraphNode_Edge;
 class UDlgDialogue;
 class FDlgBrowserTreeVariableProperties;
+struct FDlgSearchFoundResult;
+
+// Searches the graph nodes of a Dialogue, see FDlgSearchUtilities
+typedef TFunction<TSharedPtr<FDlgSearchFoundResult>(const UDlgDialogue*)> FDlgBrowserGraphNodesSearch;
 
 class FDlgBrowserTreeVariableProperties : public FDlgTreeViewVariableProperties
 {
@@ -21,6 +25,17 @@ public:
 
 	// Dialogues:
 	void AddDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue) override;
+	void RemoveDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue, const FGuid& DialogueGUID) override;
+
+	// Deferred graph node searches, they are only run once the nodes of that Dialogue are displayed.
+	void AddGraphNodesSearch(const FGuid& DialogueGUID, FDlgBrowserGraphNodesSearch&& Search)
+	{
+		PendingGraphNodesSearches.FindOrAdd(DialogueGUID).Add(MoveTemp(Search));
+	}
+	bool HasPendingGraphNodesSearches(const FGuid& DialogueGUID) const { return PendingGraphNodesSearches.Contains(DialogueGUID); }
+
+	// Runs all the pending searches for this Dialogue and fills the GraphNodes and EdgeNodes
+	void ResolveGraphNodesSearches(const UDlgDialogue* Dialogue);
 
 	// GraphNodes:
 	bool HasGraphNodeSet(const FGuid& DialogueGUID) { return GraphNodes.Find(DialogueGUID) != nullptr; }
@@ -62,4 +77,11 @@ protected:
 	 * Value: All edge in the Dialogue that contain this condition.
 	 */
 	TMap<FGuid, TSet<TWeakObjectPtr<const UDialogueGraphNode_Edge>>> EdgeNodes;
+
+	/**
+	 * The searches not yet run for the GraphNodes and EdgeNodes
+	 * Key: The unique identifier for the Dialogue
+	 * Value: All the searches for the Dialogue
+	 */
+	TMap<FGuid, TArray<FDlgBrowserGraphNodesSearch>> PendingGraphNodesSearches;
 };
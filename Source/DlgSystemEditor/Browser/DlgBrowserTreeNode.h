@@ -133,8 +133,13 @@ public:
 	{
 		Super::ClearChildren();
 		InlineChildren.Empty();
+		bChildrenBuilt = false;
 	}
 
+	// Children are built lazily, only when the tree view asks for them.
+	bool AreChildrenBuilt() const { return bChildrenBuilt; }
+	void SetChildrenBuilt(bool bInChildrenBuilt) { bChildrenBuilt = bInChildrenBuilt; }
+
 	void AddInlineChild(const TSharedPtr<Self>& ChildNode, bool bIsInline = false)
 	{
 		ensure(!ChildNode->IsRoot());
@@ -267,6 +272,9 @@ protected:
 
 	// Inline Nodes, Nodes that are displayed in the same line as this Node
 	TArray<TSharedPtr<Self>> InlineChildren;
+
+	// Were the Children and InlineChildren of this Node built?
+	bool bChildrenBuilt = false;
 };
 
 
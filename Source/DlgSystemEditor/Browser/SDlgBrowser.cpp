@@ -2,6 +2,8 @@
 #include "SDlgBrowser.h"
 
 #include "Editor.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/ITransaction.h"
 #include "Widgets/Input/SComboBox.h"
 #include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Images/SImage.h"
@@ -11,6 +13,7 @@
 
 #include "DlgSystem/DlgManager.h"
 #include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/DlgConstants.h"
 #include "DlgSystemEditor/DlgStyle.h"
 #include "DlgSystemEditor/Search/DlgSearchUtilities.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode.h"
@@ -237,223 +240,387 @@ void SDlgBrowser::Construct(const FArguments& InArgs)
 	];
 
 	RefreshTree(false);
+
+	// Keep the ParticipantsProperties up to date per Dialogue instead of rescanning everything
+	OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddSP(this, &Self::HandleObjectPropertyChanged);
+	OnObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddSP(this, &Self::HandleObjectTransacted);
+	OnAssetsPreDeleteHandle = FEditorDelegates::OnAssetsPreDelete.AddSP(this, &Self::HandleAssetsPreDelete);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(NAME_MODULE_AssetRegistry).Get();
+	OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddSP(this, &Self::HandleAssetAdded);
+	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddSP(this, &Self::HandleAssetRemoved);
+	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddSP(this, &Self::HandleAssetRenamed);
 }
 
-void SDlgBrowser::RefreshTree(bool bPreserveExpansion)
+SDlgBrowser::~SDlgBrowser()
 {
-	// First, save off current expansion state
-	TSet<TSharedPtr<FDlgBrowserTreeNode>> OldExpansionState;
-	if (bPreserveExpansion)
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+	FCoreUObjectDelegates::OnObjectTransacted.Remove(OnObjectTransactedHandle);
+	FEditorDelegates::OnAssetsPreDelete.Remove(OnAssetsPreDeleteHandle);
+
+	// The asset registry might be unloaded already on shutdown
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(NAME_MODULE_AssetRegistry))
 	{
-		ParticipantsTreeView->GetExpandedItems(OldExpansionState);
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(OnAssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(OnAssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedHandle);
 	}
+}
 
-	RootTreeItem->ClearChildren();
-	RootChildren.Empty();
+void SDlgBrowser::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+	if (DirtyDialogues.Num() == 0)
+	{
+		return;
+	}
+
+	// Only the changed Dialogues are patched, the rest of the ParticipantsProperties is kept
+	for (const TWeakObjectPtr<const UDlgDialogue>& Dialogue : DirtyDialogues)
+	{
+		PatchDialogue(Dialogue);
+	}
+	DirtyDialogues.Empty();
+
+	BuildTree(true);
+	if (!FilterString.IsEmpty())
+	{
+		GenerateFilteredItems();
+	}
+}
+
+void SDlgBrowser::RefreshTree(bool bPreserveExpansion)
+{
+	DirtyDialogues.Empty();
+	RebuildParticipantsProperties();
+	BuildTree(bPreserveExpansion);
+}
+
+void SDlgBrowser::RebuildParticipantsProperties()
+{
 	ParticipantsProperties.Empty();
+	ParticipantsSearchIndex.Empty();
+	IndexedDialogues.Empty();
 
-	auto PopulateVariablePropertiesFromSearchResult = [](
-		const TSharedPtr<FDlgBrowserTreeVariableProperties> VariableProperties,
-		const TSharedPtr<FDlgSearchFoundResult> SearchResult,
-		const FGuid& DialogueGUID
-	)
+	// Build fast lookup structure for participants (the ParticipantsProperties)
+	for (const UDlgDialogue* Dialogue : UDlgManager::GetAllDialoguesFromMemory())
 	{
-		if (VariableProperties->HasGraphNodeSet(DialogueGUID))
+		AddDialogueToParticipantsProperties(Dialogue);
+	}
+
+	// Sort the properties and index them for the filtering
+	for (const auto& Elem : ParticipantsProperties)
+	{
+		TSharedPtr<FDlgBrowserTreeParticipantProperties> Property = Elem.Value;
+
+		// sort
+		Property->Sort();
+		BuildParticipantSearchIndex(Elem.Key, Property);
+	}
+}
+
+void SDlgBrowser::PatchDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue)
+{
+	TSet<FName> TouchedParticipants;
+
+	// Remove the old entries, the Dialogue might be destroyed already
+	FGuid OldDialogueGUID;
+	if (IndexedDialogues.RemoveAndCopyValue(Dialogue, OldDialogueGUID))
+	{
+		for (const auto& Elem : ParticipantsProperties)
 		{
-			VariableProperties
-				->GetMutableGraphNodeSet(DialogueGUID)
-				->Append(SearchResult->GraphNodes);
+			if (Elem.Value->GetDialogues().Contains(Dialogue))
+			{
+				Elem.Value->RemoveDialogue(Dialogue, OldDialogueGUID);
+				TouchedParticipants.Add(Elem.Key);
+			}
 		}
-		if (VariableProperties->HasEdgeNodeSet(DialogueGUID))
+	}
+
+	// Add the new entries
+	if (IsValid(Dialogue.Get()))
+	{
+		TouchedParticipants.Append(AddDialogueToParticipantsProperties(Dialogue.Get()));
+	}
+
+	for (const FName& ParticipantName : TouchedParticipants)
+	{
+		ParticipantsSearchIndex.Remove(ParticipantName);
+
+		const TSharedPtr<FDlgBrowserTreeParticipantProperties> Property = ParticipantsProperties.FindRef(ParticipantName);
+		if (!Property.IsValid() || !Property->HasDialogues())
 		{
-			VariableProperties
-				->GetMutableEdgeNodeSet(DialogueGUID)
-				->Append(SearchResult->EdgeNodes);
+			// No Dialogue uses this participant anymore
+			ParticipantsProperties.Remove(ParticipantName);
+			continue;
 		}
-	};
 
-	// Build fast lookup structure for participants (the ParticipantsProperties)
-	TArray<UDlgDialogue*> Dialogues = UDlgManager::GetAllDialoguesFromMemory();
-	for (const UDlgDialogue* Dialogue : Dialogues)
+		Property->Sort();
+		BuildParticipantSearchIndex(ParticipantName, Property);
+	}
+}
+
+void SDlgBrowser::MarkDialogueDirty(const UObject* Object)
+{
+	if (!Object)
+	{
+		return;
+	}
+
+	// Graph nodes and Dialogue nodes are inside the Dialogue
+	const UDlgDialogue* Dialogue = Cast<UDlgDialogue>(Object);
+	if (!Dialogue)
 	{
-		const FGuid DialogueGUID = Dialogue->GetGUID();
+		Dialogue = Object->GetTypedOuter<UDlgDialogue>();
+	}
+	if (Dialogue)
+	{
+		DirtyDialogues.Add(Dialogue);
+	}
+}
+
+void SDlgBrowser::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Wait for the value to be set
+	if (PropertyChangedEvent.ChangeType != EPropertyChangeType::Interactive)
+	{
+		MarkDialogueDirty(Object);
+	}
+}
+
+void SDlgBrowser::HandleObjectTransacted(UObject* Object, const FTransactionObjectEvent& TransactionEvent)
+{
+	// Graph edits and undo/redo
+	MarkDialogueDirty(Object);
+}
+
+void SDlgBrowser::HandleAssetAdded(const FAssetData& InAssetData)
+{
+	// Only the Dialogues in memory are displayed, same as in RebuildParticipantsProperties
+	const UDlgDialogue* Dialogue = Cast<UDlgDialogue>(InAssetData.FastGetAsset(false));
+	if (Dialogue && !IndexedDialogues.Contains(Dialogue))
+	{
+		DirtyDialogues.Add(Dialogue);
+	}
+}
 
-		// Populate Participants
-		TSet<FName> ParticipantsNames = Dialogue->GetParticipantNames();
-		for (const FName& ParticipantName : ParticipantsNames)
+void SDlgBrowser::HandleAssetRemoved(const FAssetData& InAssetData)
+{
+	MarkDialogueDirty(Cast<UDlgDialogue>(InAssetData.FastGetAsset(false)));
+}
+
+void SDlgBrowser::HandleAssetRenamed(const FAssetData& InAssetData, const FString& InOldName)
+{
+	MarkDialogueDirty(Cast<UDlgDialogue>(InAssetData.FastGetAsset(false)));
+}
+
+void SDlgBrowser::HandleAssetsPreDelete(const TArray<UObject*>& Objects)
+{
+	// Patched on the next tick, once the Dialogues are not valid anymore
+	for (const UObject* Object : Objects)
+	{
+		MarkDialogueDirty(Cast<UDlgDialogue>(Object));
+	}
+}
+
+TSet<FName> SDlgBrowser::AddDialogueToParticipantsProperties(const UDlgDialogue* Dialogue)
+{
+	// The graph nodes search is expensive, only remember it here, it runs when the nodes of the Dialogue are displayed
+	auto AddDeferredGraphNodesSearch = [](
+		const TSharedPtr<FDlgBrowserTreeVariableProperties> VariableProperties,
+		FDlgBrowserGraphNodesSearch&& Search,
+		const FGuid& DialogueGUID
+	)
+	{
+		VariableProperties->AddGraphNodesSearch(DialogueGUID, MoveTemp(Search));
+	};
+
+	const FGuid DialogueGUID = Dialogue->GetGUID();
+	IndexedDialogues.Add(Dialogue, DialogueGUID);
+
+	// Populate Participants
+	TSet<FName> ParticipantsNames = Dialogue->GetParticipantNames();
+	for (const FName& ParticipantName : ParticipantsNames)
+	{
+		TSharedPtr<FDlgBrowserTreeParticipantProperties>* ParticipantPropsPtr = ParticipantsProperties.Find(ParticipantName);
+		TSharedPtr<FDlgBrowserTreeParticipantProperties> ParticipantProps;
+		if (ParticipantPropsPtr == nullptr)
 		{
-			TSharedPtr<FDlgBrowserTreeParticipantProperties>* ParticipantPropsPtr = ParticipantsProperties.Find(ParticipantName);
-			TSharedPtr<FDlgBrowserTreeParticipantProperties> ParticipantProps;
-			if (ParticipantPropsPtr == nullptr)
-			{
-				// participant does not exist, create it
-				const TSet<TWeakObjectPtr<const UDlgDialogue>> SetArgument{Dialogue};
-				ParticipantProps = MakeShared<FDlgBrowserTreeParticipantProperties>(SetArgument);
-				ParticipantsProperties.Add(ParticipantName, ParticipantProps);
-			}
-			else
-			{
-				// exists
-				ParticipantProps = *ParticipantPropsPtr;
-				ParticipantProps->AddDialogue(Dialogue);
-			}
+			// participant does not exist, create it
+			const TSet<TWeakObjectPtr<const UDlgDialogue>> SetArgument{Dialogue};
+			ParticipantProps = MakeShared<FDlgBrowserTreeParticipantProperties>(SetArgument);
+			ParticipantsProperties.Add(ParticipantName, ParticipantProps);
+		}
+		else
+		{
+			// exists
+			ParticipantProps = *ParticipantPropsPtr;
+			ParticipantProps->AddDialogue(Dialogue);
+		}
 
-			// Populate events
-			const TSet<FName> EventsNames = Dialogue->GetParticipantEventNames(ParticipantName);
-			for (const FName& EventName : EventsNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToEvent(EventName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForEventEventName(EventName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate events
+		const TSet<FName> EventsNames = Dialogue->GetParticipantEventNames(ParticipantName);
+		for (const FName& EventName : EventsNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToEvent(EventName, Dialogue),
+				[EventName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForEventEventName(EventName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate Unreal Function Names
-			const TSet<FName> FunctionNames = Dialogue->GetParticipantFunctionNames(ParticipantName);
-			for (const FName& FunctionName : FunctionNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToEvent(FunctionName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForFunctionEventName(FunctionName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate Unreal Function Names
+		const TSet<FName> FunctionNames = Dialogue->GetParticipantFunctionNames(ParticipantName);
+		for (const FName& FunctionName : FunctionNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToEvent(FunctionName, Dialogue),
+				[FunctionName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForFunctionEventName(FunctionName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate Custom events
-			const TSet<UClass*> CustomEventsClasses = Dialogue->GetParticipantCustomEvents(ParticipantName);
-			for (UClass* EventClass : CustomEventsClasses)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToCustomEvent(EventClass, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForCustomEvent(EventClass, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate Custom events
+		const TSet<UClass*> CustomEventsClasses = Dialogue->GetParticipantCustomEvents(ParticipantName);
+		for (UClass* EventClass : CustomEventsClasses)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToCustomEvent(EventClass, Dialogue),
+				[EventClass](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForCustomEvent(EventClass, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate conditions
-			const TSet<FName> ConditionNames = Dialogue->GetParticipantConditionNames(ParticipantName);
-			for (const FName& ConditionName : ConditionNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToCondition(ConditionName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForConditionEventCallName(ConditionName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate conditions
+		const TSet<FName> ConditionNames = Dialogue->GetParticipantConditionNames(ParticipantName);
+		for (const FName& ConditionName : ConditionNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToCondition(ConditionName, Dialogue),
+				[ConditionName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForConditionEventCallName(ConditionName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate int variable names
-			const TSet<FName> IntVariableNames = Dialogue->GetParticipantIntNames(ParticipantName);
-			for (const FName& IntVariableName : IntVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToIntVariable(IntVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForIntVariableName(IntVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate int variable names
+		const TSet<FName> IntVariableNames = Dialogue->GetParticipantIntNames(ParticipantName);
+		for (const FName& IntVariableName : IntVariableNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToIntVariable(IntVariableName, Dialogue),
+				[IntVariableName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForIntVariableName(IntVariableName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate float variable names
-			const TSet<FName> FloatVariableNames = Dialogue->GetParticipantFloatNames(ParticipantName);
-			for (const FName& FloatVariableName : FloatVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToFloatVariable(FloatVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForFloatVariableName(FloatVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate float variable names
+		const TSet<FName> FloatVariableNames = Dialogue->GetParticipantFloatNames(ParticipantName);
+		for (const FName& FloatVariableName : FloatVariableNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToFloatVariable(FloatVariableName, Dialogue),
+				[FloatVariableName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForFloatVariableName(FloatVariableName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate bool variable names
-			const TSet<FName> BoolVariableNames = Dialogue->GetParticipantBoolNames(ParticipantName);
-			for (const FName& BoolVariableName : BoolVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToBoolVariable(BoolVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForBoolVariableName(BoolVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate bool variable names
+		const TSet<FName> BoolVariableNames = Dialogue->GetParticipantBoolNames(ParticipantName);
+		for (const FName& BoolVariableName : BoolVariableNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToBoolVariable(BoolVariableName, Dialogue),
+				[BoolVariableName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForBoolVariableName(BoolVariableName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate FName variable names
-			const TSet<FName> FNameVariableNames = Dialogue->GetParticipantFNameNames(ParticipantName);
-			for (const FName& NameVariableName : FNameVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToFNameVariable(NameVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForFNameVariableName(NameVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate FName variable names
+		const TSet<FName> FNameVariableNames = Dialogue->GetParticipantFNameNames(ParticipantName);
+		for (const FName& NameVariableName : FNameVariableNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToFNameVariable(NameVariableName, Dialogue),
+				[NameVariableName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForFNameVariableName(NameVariableName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate UClass int variable names
-			const TSet<FName> ClassIntVariableNames = Dialogue->GetParticipantClassIntNames(ParticipantName);
-			for (const FName& IntVariableName : ClassIntVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToClassIntVariable(IntVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForClassIntVariableName(IntVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate UClass int variable names
+		const TSet<FName> ClassIntVariableNames = Dialogue->GetParticipantClassIntNames(ParticipantName);
+		for (const FName& IntVariableName : ClassIntVariableNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToClassIntVariable(IntVariableName, Dialogue),
+				[IntVariableName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForClassIntVariableName(IntVariableName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate UClass float variable names
-			const TSet<FName> ClassFloatVariableNames = Dialogue->GetParticipantClassFloatNames(ParticipantName);
-			for (const FName& FloatVariableName : ClassFloatVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToClassFloatVariable(FloatVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForClassFloatVariableName(FloatVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate UClass float variable names
+		const TSet<FName> ClassFloatVariableNames = Dialogue->GetParticipantClassFloatNames(ParticipantName);
+		for (const FName& FloatVariableName : ClassFloatVariableNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToClassFloatVariable(FloatVariableName, Dialogue),
+				[FloatVariableName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForClassFloatVariableName(FloatVariableName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate UClass bool variable names
-			const TSet<FName> ClassBoolVariableNames = Dialogue->GetParticipantClassBoolNames(ParticipantName);
-			for (const FName& BoolVariableName : ClassBoolVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToClassBoolVariable(BoolVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForClassBoolVariableName(BoolVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate UClass bool variable names
+		const TSet<FName> ClassBoolVariableNames = Dialogue->GetParticipantClassBoolNames(ParticipantName);
+		for (const FName& BoolVariableName : ClassBoolVariableNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToClassBoolVariable(BoolVariableName, Dialogue),
+				[BoolVariableName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForClassBoolVariableName(BoolVariableName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate UClass FName variable names
-			const TSet<FName> ClassFNameVariableNames = Dialogue->GetParticipantClassFNameNames(ParticipantName);
-			for (const FName& NameVariableName : ClassFNameVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToClassFNameVariable(NameVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForClassFNameVariableName(NameVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate UClass FName variable names
+		const TSet<FName> ClassFNameVariableNames = Dialogue->GetParticipantClassFNameNames(ParticipantName);
+		for (const FName& NameVariableName : ClassFNameVariableNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToClassFNameVariable(NameVariableName, Dialogue),
+				[NameVariableName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForClassFNameVariableName(NameVariableName, InDialogue); },
+				DialogueGUID
+			);
+		}
 
-			// Populate UClass FText variable names
-			const TSet<FName> ClassFTextVariableNames = Dialogue->GetParticipantClassFTextNames(ParticipantName);
-			for (const FName& TextVariableName : ClassFTextVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToClassFTextVariable(TextVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForClassFTextVariableName(TextVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate UClass FText variable names
+		const TSet<FName> ClassFTextVariableNames = Dialogue->GetParticipantClassFTextNames(ParticipantName);
+		for (const FName& TextVariableName : ClassFTextVariableNames)
+		{
+			AddDeferredGraphNodesSearch(
+				ParticipantProps->AddDialogueToClassFTextVariable(TextVariableName, Dialogue),
+				[TextVariableName](const UDlgDialogue* InDialogue) { return FDlgSearchUtilities::GetGraphNodesForClassFTextVariableName(TextVariableName, InDialogue); },
+				DialogueGUID
+			);
 		}
 	}
 
-	// Sort the properties
-	TArray<FName> AllParticipants;
-	for (const auto& Elem : ParticipantsProperties)
-	{
-		AllParticipants.Add(Elem.Key);
-		TSharedPtr<FDlgBrowserTreeParticipantProperties> Property = Elem.Value;
+	return ParticipantsNames;
+}
 
-		// sort
-		Property->Sort();
+void SDlgBrowser::BuildTree(bool bPreserveExpansion)
+{
+	// First, save off current expansion state
+	TSet<TSharedPtr<FDlgBrowserTreeNode>> OldExpansionState;
+	if (bPreserveExpansion)
+	{
+		ParticipantsTreeView->GetExpandedItems(OldExpansionState);
 	}
 
+	RootTreeItem->ClearChildren();
+	RootChildren.Empty();
+
+	TArray<FName> AllParticipants;
+	ParticipantsProperties.GetKeys(AllParticipants);
+
 	// Sort the participant names
 	if (SelectedSortOption->IsByName())
 	{
@@ -469,16 +636,16 @@ void SDlgBrowser::RefreshTree(bool bPreserveExpansion)
 		});
 	}
 
-	// Build the tree
+	// Build the tree, only the participants, their children are built when the tree view asks for them in HandleGetChildren
 	for (const FName& Name : AllParticipants)
 	{
 		const TSharedPtr<FDlgBrowserTreeNode> Participant =
 			MakeShared<FDialogueBrowserTreeCategoryParticipantNode>(FText::FromName(Name), RootTreeItem, Name);
 
-		BuildTreeViewItem(Participant);
 		RootTreeItem->AddChild(Participant);
 		RootTreeItem->AddChild(MakeShared<FDialogueBrowserTreeSeparatorNode>(RootTreeItem));
 	}
+	RootTreeItem->SetChildrenBuilt(true);
 	RootTreeItem->GetVisibleChildren(RootChildren);
 
 	// Clear Previous states
@@ -489,29 +656,111 @@ void SDlgBrowser::RefreshTree(bool bPreserveExpansion)
 	// Restore old expansion
 	if (bPreserveExpansion && OldExpansionState.Num() > 0)
 	{
-		// Flattened tree
-		TArray<TSharedPtr<FDlgBrowserTreeNode>> AllNodes;
-		RootTreeItem->GetAllNodes(AllNodes);
+		RestoreTreeExpansionState(RootTreeItem, OldExpansionState);
+	}
+}
 
-		// Expand to match the old state
-		FDlgTreeViewHelper::RestoreTreeExpansionState<TSharedPtr<FDlgBrowserTreeNode>>(
-			ParticipantsTreeView,
-			AllNodes,
-			OldExpansionState,
-			FDlgBrowserUtilities::PredicateCompareDialogueTreeNode
-		);
+void SDlgBrowser::RestoreTreeExpansionState(
+	const TSharedPtr<FDlgBrowserTreeNode>& Item,
+	const TSet<TSharedPtr<FDlgBrowserTreeNode>>& OldExpansionState
+)
+{
+	for (const TSharedPtr<FDlgBrowserTreeNode>& Child : Item->GetChildren())
+	{
+		for (const TSharedPtr<FDlgBrowserTreeNode>& OldItem : OldExpansionState)
+		{
+			if (FDlgBrowserUtilities::PredicateCompareDialogueTreeNode(OldItem, Child))
+			{
+				// Was expanded, build it so that we can match its children
+				ParticipantsTreeView->SetItemExpansion(Child, true);
+				BuildTreeViewItem(Child);
+				RestoreTreeExpansionState(Child, OldExpansionState);
+				break;
+			}
+		}
 	}
 }
 
+void SDlgBrowser::BuildParticipantSearchIndex(
+	FName ParticipantName,
+	const TSharedPtr<FDlgBrowserTreeParticipantProperties>& ParticipantProperties
+)
+{
+	TArray<FString>& SearchIndex = ParticipantsSearchIndex.FindOrAdd(ParticipantName);
+	SearchIndex.Add(ParticipantName.ToString());
+
+	for (TWeakObjectPtr<const UDlgDialogue> Dialogue : ParticipantProperties->GetDialogues())
+	{
+		if (Dialogue.IsValid())
+		{
+			SearchIndex.Add(Dialogue->GetDialogueFName().ToString());
+		}
+	}
+	for (const auto& Pair : ParticipantProperties->GetCustomEvents())
+	{
+		if (Pair.Key)
+		{
+			SearchIndex.Add(FDlgHelper::CleanObjectName(Pair.Key->GetPathName()));
+		}
+	}
+
+	auto AddVariableNames = [&SearchIndex](const TMap<FName, TSharedPtr<FDlgBrowserTreeVariableProperties>>& Variables)
+	{
+		for (const auto& Pair : Variables)
+		{
+			SearchIndex.Add(Pair.Key.ToString());
+		}
+	};
+	AddVariableNames(ParticipantProperties->GetEvents());
+	AddVariableNames(ParticipantProperties->GetConditions());
+	AddVariableNames(ParticipantProperties->GetIntegers());
+	AddVariableNames(ParticipantProperties->GetFloats());
+	AddVariableNames(ParticipantProperties->GetBools());
+	AddVariableNames(ParticipantProperties->GetFNames());
+	AddVariableNames(ParticipantProperties->GetClassIntegers());
+	AddVariableNames(ParticipantProperties->GetClassFloats());
+	AddVariableNames(ParticipantProperties->GetClassBools());
+	AddVariableNames(ParticipantProperties->GetClassFNames());
+	AddVariableNames(ParticipantProperties->GetClassFTexts());
+}
+
+bool SDlgBrowser::DoesParticipantMatchFilter(FName ParticipantName, const FString& InSearch) const
+{
+	const TArray<FString>* SearchIndexPtr = ParticipantsSearchIndex.Find(ParticipantName);
+	if (SearchIndexPtr == nullptr)
+	{
+		return false;
+	}
+
+	for (const FString& Text : *SearchIndexPtr)
+	{
+		if (Text.Contains(InSearch, ESearchCase::IgnoreCase))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void SDlgBrowser::GenerateFilteredItems()
 {
 	if (FilterString.IsEmpty())
 	{
 		// No filtering, empty filter, restore original
-		RefreshTree(false);
+		BuildTree(false);
 		return;
 	}
 
+	// Only the participants that can contain the text need to be fully built, the rest will be hidden anyway
+	for (const TSharedPtr<FDlgBrowserTreeNode>& Participant : RootTreeItem->GetChildren())
+	{
+		if (!Participant->IsSeparator() && DoesParticipantMatchFilter(Participant->GetParentParticipantName(), FilterString))
+		{
+			BuildTreeViewItemRecursive(Participant);
+		}
+	}
+
 	// Get all valid paths
 	TArray<TArray<TSharedPtr<FDlgBrowserTreeNode>>> OutPaths;
 	RootTreeItem->FilterPathsToNodesThatContainText(FilterString, OutPaths);
@@ -659,6 +908,9 @@ void SDlgBrowser::AddGraphNodeBaseChildrenToItemFromProperty(
 	const UDlgDialogue* Dialogue = DialogueItem->GetDialogue().Get();
 	const FGuid DialogueGUID = Dialogue->GetGUID();
 
+	// First time we display the nodes of this Dialogue
+	Property->ResolveGraphNodesSearches(Dialogue);
+
 	// Display the GraphNode
 	if (Property->HasGraphNodeSet(DialogueGUID))
 	{
@@ -688,6 +940,12 @@ void SDlgBrowser::AddVariableChildrenToItem(
 
 void SDlgBrowser::BuildTreeViewItem(const TSharedPtr<FDlgBrowserTreeNode>& Item)
 {
+	if (!Item.IsValid() || Item->AreChildrenBuilt())
+	{
+		return;
+	}
+	Item->SetChildrenBuilt(true);
+
 	const FName ParticipantName = Item->GetParentParticipantName();
 	if (!ParticipantName.IsValid() || ParticipantName.IsNone())
 	{
@@ -1078,17 +1336,14 @@ void SDlgBrowser::BuildTreeViewItem(const TSharedPtr<FDlgBrowserTreeNode>& Item)
 			break;
 		}
 	}
+}
 
-	// Recursively call on children
+void SDlgBrowser::BuildTreeViewItemRecursive(const TSharedPtr<FDlgBrowserTreeNode>& Item)
+{
+	BuildTreeViewItem(Item);
 	for (const TSharedPtr<FDlgBrowserTreeNode>& ChildItem : Item->GetChildren())
 	{
-		BuildTreeViewItem(ChildItem);
-	}
-
-	// The same for the inline children, handled separately.
-	for (const TSharedPtr<FDlgBrowserTreeNode>& ChildItem : Item->GetInlineChildren())
-	{
-		BuildTreeViewItem(ChildItem);
+		BuildTreeViewItemRecursive(ChildItem);
 	}
 }
 
@@ -1233,6 +1488,9 @@ TSharedRef<ITableRow> SDlgBrowser::HandleGenerateRow(
 	const TSharedRef<STableViewBase>& OwnerTable
 )
 {
+	// The inline children are displayed in the row
+	BuildTreeViewItem(InItem);
+
 	// Build row
 	TSharedPtr<STableRow<TSharedPtr<FDlgBrowserTreeNode>>> TableRow;
 	FMargin RowPadding = FMargin(2.f, 2.f);
@@ -1444,6 +1702,9 @@ void SDlgBrowser::HandleGetChildren(TSharedPtr<FDlgBrowserTreeNode> InItem, TArr
 	{
 		return;
 	}
+
+	// Build on demand, only the items the tree view reaches are ever built
+	BuildTreeViewItem(InItem);
 	if (InItem->HasChildren())
 	{
 		InItem->GetVisibleChildren(OutChildren);
@@ -1468,6 +1729,7 @@ void SDlgBrowser::HandleDoubleClick(TSharedPtr<FDlgBrowserTreeNode> InItem)
 	}
 
 	// Expand on double click
+	BuildTreeViewItem(InItem);
 	if (InItem->HasChildren())
 	{
 		ParticipantsTreeView->SetItemExpansion(InItem, !ParticipantsTreeView->IsItemExpanded(InItem));
@@ -1476,6 +1738,10 @@ void SDlgBrowser::HandleDoubleClick(TSharedPtr<FDlgBrowserTreeNode> InItem)
 
 void SDlgBrowser::HandleSetExpansionRecursive(TSharedPtr<FDlgBrowserTreeNode> InItem, bool bInIsItemExpanded)
 {
+	if (bInIsItemExpanded)
+	{
+		BuildTreeViewItem(InItem);
+	}
 	if (InItem.IsValid() && InItem->HasChildren())
 	{
 		ParticipantsTreeView->SetItemExpansion(InItem, bInIsItemExpanded);
@@ -1491,7 +1757,9 @@ void SDlgBrowser::HandleSortSelectionChanged(SortOptionType Selection, ESelectIn
 	if (Selection.IsValid())
 	{
 		SelectedSortOption = Selection;
-		RefreshTree(true);
+
+		// Only the order changed, reuse the participants properties
+		BuildTree(true);
 	}
 }
 
@@ -1880,7 +2148,7 @@ TSharedRef<SWidget> SDlgBrowser::FillViewOptionsEntries()
 			{
 				UDlgSystemSettings* Settings = GetMutableDefault<UDlgSystemSettings>();
 				Settings->SetHideEmptyDialogueBrowserCategories(!Settings->bHideEmptyDialogueBrowserCategories);
-				RefreshTree(true);
+				BuildTree(true);
 			}),
 			FCanExecuteAction(),
 			FIsActionChecked::CreateLambda([]() -> bool
@@ -13,6 +13,8 @@
 
 enum class EDlgBlueprintOpenType : unsigned char;
 class UDlgDialogue;
+class FTransactionObjectEvent;
+struct FAssetData;
 class SImage;
 
 /**
@@ -28,14 +30,57 @@ public:
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs);
+	~SDlgBrowser();
 
-	// Updates the participants tree.
+	// SWidget interface
+	void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+	// Rescans all the Dialogues and updates the participants tree.
 	void RefreshTree(bool bPreserveExpansion);
 
 	// Get current filter text
 	FText GetFilterText() const { return FilterTextBoxWidget->GetText(); }
 
 protected:
+	// Rebuilds the fast lookup structure of the participants and the search index from all the dialogues.
+	void RebuildParticipantsProperties();
+
+	// Adds the participants of this Dialogue to the ParticipantsProperties, returns the names of the participants it touched.
+	TSet<FName> AddDialogueToParticipantsProperties(const UDlgDialogue* Dialogue);
+
+	// Removes the entries of this Dialogue from the ParticipantsProperties and adds them back if it is still valid.
+	// Only the ParticipantsSearchIndex of the touched participants is rebuilt.
+	void PatchDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue);
+
+	// The Dialogue of Object (or its outer) is patched on the next tick.
+	void MarkDialogueDirty(const UObject* Object);
+
+	// Dialogue change, add and remove notifications.
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	void HandleObjectTransacted(UObject* Object, const FTransactionObjectEvent& TransactionEvent);
+	void HandleAssetAdded(const FAssetData& InAssetData);
+	void HandleAssetRemoved(const FAssetData& InAssetData);
+	void HandleAssetRenamed(const FAssetData& InAssetData, const FString& InOldName);
+	void HandleAssetsPreDelete(const TArray<UObject*>& Objects);
+
+	// Rebuilds the tree from the ParticipantsProperties, only the top level is built, the rest is built on demand.
+	void BuildTree(bool bPreserveExpansion);
+
+	// Expands the children of Item that were expanded before, building them as needed.
+	void RestoreTreeExpansionState(
+		const TSharedPtr<FDlgBrowserTreeNode>& Item,
+		const TSet<TSharedPtr<FDlgBrowserTreeNode>>& OldExpansionState
+	);
+
+	// Fills the ParticipantsSearchIndex for this participant.
+	void BuildParticipantSearchIndex(
+		FName ParticipantName,
+		const TSharedPtr<FDlgBrowserTreeParticipantProperties>& ParticipantProperties
+	);
+
+	// Can this participant contain any node that matches the InSearch?
+	bool DoesParticipantMatchFilter(FName ParticipantName, const FString& InSearch) const;
+
 	// Handle filtering.
 	void GenerateFilteredItems();
 
@@ -77,9 +122,12 @@ protected:
 		EDlgTreeNodeTextType VariableType
 	);
 
-	// Recursively build the view item.
+	// Builds the children of the view item, if they were not built already.
 	void BuildTreeViewItem(const TSharedPtr<FDlgBrowserTreeNode>& Item);
 
+	// Recursively build the view item.
+	void BuildTreeViewItemRecursive(const TSharedPtr<FDlgBrowserTreeNode>& Item);
+
 	// helper function to generate inline widgets for item.
 	TSharedRef<SWidget> MakeInlineWidget(const TSharedPtr<FDlgBrowserTreeNode>& InItem);
 
@@ -195,6 +243,30 @@ protected:
 	 */
 	TMap<FName, TSharedPtr<FDlgBrowserTreeParticipantProperties>> ParticipantsProperties;
 
+	/**
+	 * All the names that are displayed under each participant, used for filtering without building the whole tree.
+	 * Key: Participant Name
+	 * Value: names of the dialogues, events, conditions, variables
+	 */
+	TMap<FName, TArray<FString>> ParticipantsSearchIndex;
+
+	/**
+	 * The Dialogues that are in the ParticipantsProperties
+	 * Key: Dialogue
+	 * Value: the GUID of the Dialogue when it was added, the variable properties are keyed by it
+	 */
+	TMap<TWeakObjectPtr<const UDlgDialogue>, FGuid> IndexedDialogues;
+
+	// Dialogues changed since the last tick, patched in one go.
+	TSet<TWeakObjectPtr<const UDlgDialogue>> DirtyDialogues;
+
+	FDelegateHandle OnObjectPropertyChangedHandle;
+	FDelegateHandle OnObjectTransactedHandle;
+	FDelegateHandle OnAssetAddedHandle;
+	FDelegateHandle OnAssetRemovedHandle;
+	FDelegateHandle OnAssetRenamedHandle;
+	FDelegateHandle OnAssetsPreDeleteHandle;
+
 	//
 	// Sort variables
 	//
@@ -0,0 +1,347 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgExplorePathsCommandlet.h"
+
+#include "Misc/Paths.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+#include "DlgSystem/DlgManager.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/DlgContext.h"
+#include "DlgSystem/DlgMemory.h"
+#include "DlgSystem/DlgHelper.h"
+#include "DlgSystem/IO/DlgJsonWriter.h"
+#include "DlgSystem/Nodes/DlgNode_End.h"
+
+
+DEFINE_LOG_CATEGORY(LogDlgExplorePathsCommandlet);
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// UDlgMockParticipant
+bool UDlgMockParticipant::CheckCondition_Implementation(const UDlgContext* Context, FName ConditionName) const
+{
+	if (const bool* Value = Conditions.Find(ConditionName))
+	{
+		return *Value;
+	}
+	return Conditions.Add(ConditionName, bRandomValues ? RandomStream.FRand() < 0.5f : true);
+}
+
+float UDlgMockParticipant::GetFloatValue_Implementation(FName ValueName) const
+{
+	if (const float* Value = FloatValues.Find(ValueName))
+	{
+		return *Value;
+	}
+	return FloatValues.Add(ValueName, bRandomValues ? RandomStream.FRandRange(-100.f, 100.f) : 0.f);
+}
+
+int32 UDlgMockParticipant::GetIntValue_Implementation(FName ValueName) const
+{
+	if (const int32* Value = IntValues.Find(ValueName))
+	{
+		return *Value;
+	}
+	return IntValues.Add(ValueName, bRandomValues ? RandomStream.RandRange(-100, 100) : 0);
+}
+
+bool UDlgMockParticipant::GetBoolValue_Implementation(FName ValueName) const
+{
+	if (const bool* Value = BoolValues.Find(ValueName))
+	{
+		return *Value;
+	}
+	return BoolValues.Add(ValueName, bRandomValues ? RandomStream.FRand() < 0.5f : false);
+}
+
+FName UDlgMockParticipant::GetNameValue_Implementation(FName ValueName) const
+{
+	if (const FName* Value = NameValues.Find(ValueName))
+	{
+		return *Value;
+	}
+	return NameValues.Add(ValueName, NAME_None);
+}
+
+bool UDlgMockParticipant::ModifyFloatValue_Implementation(FName ValueName, bool bDelta, float Value)
+{
+	float& StoredValue = FloatValues.FindOrAdd(ValueName);
+	StoredValue = bDelta ? StoredValue + Value : Value;
+	return true;
+}
+
+bool UDlgMockParticipant::ModifyIntValue_Implementation(FName ValueName, bool bDelta, int32 Value)
+{
+	int32& StoredValue = IntValues.FindOrAdd(ValueName);
+	StoredValue = bDelta ? StoredValue + Value : Value;
+	return true;
+}
+
+bool UDlgMockParticipant::ModifyBoolValue_Implementation(FName ValueName, bool bNewValue)
+{
+	BoolValues.Add(ValueName, bNewValue);
+	return true;
+}
+
+bool UDlgMockParticipant::ModifyNameValue_Implementation(FName ValueName, FName NameValue)
+{
+	NameValues.Add(ValueName, NameValue);
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// UDlgExplorePathsCommandlet
+UDlgExplorePathsCommandlet::UDlgExplorePathsCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UDlgExplorePathsCommandlet::Main(const FString& Params)
+{
+	UE_LOG(LogDlgExplorePathsCommandlet, Display, TEXT("Starting"));
+
+	// Parse command line - we're interested in the param vals
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	UCommandlet::ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	auto GetIntParam = [&ParamVals](const TCHAR* Name, int32 DefaultValue) -> int32
+	{
+		const FString* Value = ParamVals.Find(Name);
+		return Value ? FCString::Atoi(**Value) : DefaultValue;
+	};
+
+	FDlgExplorePathsReport Report;
+	MaxDepth = FMath::Max(1, GetIntParam(TEXT("MaxDepth"), MaxDepth));
+	MaxPaths = FMath::Max(1, GetIntParam(TEXT("MaxPaths"), MaxPaths));
+	CollectGarbageEveryNumPaths = FMath::Max(1, GetIntParam(TEXT("GCPaths"), CollectGarbageEveryNumPaths));
+	Report.NumShards = FMath::Max(1, GetIntParam(TEXT("NumShards"), 1));
+	Report.Shard = FMath::Clamp(GetIntParam(TEXT("Shard"), 0), 0, Report.NumShards - 1);
+	const int32 Seed = GetIntParam(TEXT("Seed"), 0);
+	bRandomValues = Switches.Contains(TEXT("RandomValues"));
+
+	// Set the output file
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("DlgExplorePaths.json");
+	if (const FString* OutputVal = ParamVals.Find(TEXT("Output")))
+	{
+		OutputPath = *OutputVal;
+	}
+	if (FPaths::IsRelative(OutputPath))
+	{
+		OutputPath = FPaths::Combine(FPaths::ProjectDir(), OutputPath);
+	}
+	if (Report.NumShards > 1)
+	{
+		OutputPath = FPaths::GetBaseFilename(OutputPath, false) + FString::Printf(TEXT("_Shard%d.json"), Report.Shard);
+	}
+
+	UDlgManager::LoadAllDialoguesIntoMemory();
+	TArray<UDlgDialogue*> AllDialogues = UDlgManager::GetAllDialoguesFromMemory();
+
+	// Same order in every shard
+	AllDialogues.Sort([](const UDlgDialogue& A, const UDlgDialogue& B)
+	{
+		return A.GetPathName() < B.GetPathName();
+	});
+	ExploredDialogues = AllDialogues;
+
+	// Keep the history of the game untouched
+	const TMap<FGuid, FDlgHistory> OriginalHistory = FDlgMemory::Get().GetHistoryMapsCopy();
+
+	double TotalStepsSeconds = 0.0;
+	for (int32 DialogueIndex = 0; DialogueIndex < AllDialogues.Num(); DialogueIndex++)
+	{
+		if (DialogueIndex % Report.NumShards != Report.Shard)
+		{
+			continue;
+		}
+
+		UDlgDialogue* Dialogue = AllDialogues[DialogueIndex];
+		const FString DialoguePath = Dialogue->GetOutermost()->GetPathName();
+		if (!FDlgHelper::IsPathInProjectDirectory(DialoguePath))
+		{
+			UE_LOG(LogDlgExplorePathsCommandlet, Warning, TEXT("Dialogue = `%s` is not in the game directory, ignoring"), *DialoguePath);
+			continue;
+		}
+
+		FDlgExplorePathsDialogueReport& DialogueReport = Report.Dialogues.AddDefaulted_GetRef();
+		DialogueReport.DialoguePath = DialoguePath;
+		ExploreDialogue(*Dialogue, HashCombine(GetTypeHash(Seed), GetTypeHash(DialoguePath)), DialogueReport);
+
+		Report.NumSteps += DialogueReport.NumSteps;
+		if (DialogueReport.StepsPerSecond > 0.0)
+		{
+			TotalStepsSeconds += DialogueReport.NumSteps / DialogueReport.StepsPerSecond;
+		}
+
+		UE_LOG(LogDlgExplorePathsCommandlet, Display,
+			TEXT("Dialogue = `%s`. Coverage = %.1f%% (%d/%d nodes), Paths = %d, Dead ends = %d, Steps per second = %.1f, Slowest step = %.3f ms (Node %d)"),
+			*DialoguePath, DialogueReport.Coverage, DialogueReport.NumVisitedNodes, DialogueReport.NumNodes, DialogueReport.NumPaths,
+			DialogueReport.DeadEndNodeIndices.Num(), DialogueReport.StepsPerSecond, DialogueReport.SlowestStepMs, DialogueReport.SlowestStepNodeIndex
+		);
+
+		// The contexts and mock participants of this Dialogue are not referenced anymore
+		CollectGarbage(RF_NoFlags);
+	}
+	ExploredDialogues.Empty();
+	Report.StepsPerSecond = TotalStepsSeconds > 0.0 ? Report.NumSteps / TotalStepsSeconds : 0.0;
+	FDlgMemory::Get().SetHistoryMap(OriginalHistory);
+
+	FDlgJsonWriter JsonWriter;
+	JsonWriter.Write(FDlgExplorePathsReport::StaticStruct(), &Report);
+	if (!JsonWriter.ExportToFile(OutputPath))
+	{
+		UE_LOG(LogDlgExplorePathsCommandlet, Error, TEXT("FAILED to write file = `%s`"), *OutputPath);
+		return -1;
+	}
+
+	UE_LOG(LogDlgExplorePathsCommandlet, Display, TEXT("Explored %d Dialogues, %d steps. Writing file = `%s`"), Report.Dialogues.Num(), Report.NumSteps, *OutputPath);
+	return 0;
+}
+
+void UDlgExplorePathsCommandlet::ExploreDialogue(UDlgDialogue& Dialogue, int32 DialogueSeed, FDlgExplorePathsDialogueReport& OutReport)
+{
+	OutReport.NumNodes = Dialogue.GetNodes().Num();
+
+	// Each option (Node -> Target) is only explored from the first path that reaches it
+	TSet<TPair<int32, int32>> ExploredOptions;
+	TSet<int32> VisitedNodeIndices;
+	TSet<int32> DeadEndNodeIndices;
+	TArray<TArray<int32>> PathsStack;
+	PathsStack.AddDefaulted();
+
+	double GarbageCollectionSeconds = 0.0;
+	const double StartTimeSeconds = FPlatformTime::Seconds();
+	while (PathsStack.Num() > 0 && OutReport.NumPaths < MaxPaths)
+	{
+		// Every path creates a new context and mock participants, no context of a previous path is alive here
+		if (OutReport.NumPaths > 0 && OutReport.NumPaths % CollectGarbageEveryNumPaths == 0)
+		{
+			const double GarbageCollectionStartSeconds = FPlatformTime::Seconds();
+			CollectGarbage(RF_NoFlags);
+			GarbageCollectionSeconds += FPlatformTime::Seconds() - GarbageCollectionStartSeconds;
+		}
+
+		const TArray<int32> Path = PathsStack.Pop();
+		OutReport.NumPaths++;
+
+		bool bEnded = false;
+		UDlgContext* Context = ReplayPath(Dialogue, DialogueSeed, Path, bEnded, OutReport);
+		if (!Context)
+		{
+			// Could not even start
+			DeadEndNodeIndices.Add(INDEX_NONE);
+			continue;
+		}
+		VisitedNodeIndices.Append(Context->GetHistoryOfThisContext().VisitedNodeIndices);
+
+		const int32 ActiveNodeIndex = Context->GetActiveNodeIndex();
+		if (bEnded)
+		{
+			if (Cast<UDlgNode_End>(Context->GetActiveNode()))
+			{
+				OutReport.NumEnds++;
+			}
+			else
+			{
+				DeadEndNodeIndices.Add(ActiveNodeIndex);
+			}
+			continue;
+		}
+
+		const int32 NumOptions = Context->GetOptionsNum();
+		OutReport.MaxOptions = FMath::Max(OutReport.MaxOptions, NumOptions);
+		if (NumOptions == 0)
+		{
+			DeadEndNodeIndices.Add(ActiveNodeIndex);
+			continue;
+		}
+		if (Path.Num() >= MaxDepth)
+		{
+			OutReport.NumTruncatedPaths++;
+			continue;
+		}
+
+		for (int32 OptionIndex = NumOptions - 1; OptionIndex >= 0; OptionIndex--)
+		{
+			bool bAlreadyExplored = false;
+			ExploredOptions.Add(TPair<int32, int32>(ActiveNodeIndex, Context->GetOption(OptionIndex).TargetIndex), &bAlreadyExplored);
+			if (!bAlreadyExplored)
+			{
+				TArray<int32>& NewPath = PathsStack.Add_GetRef(Path);
+				NewPath.Add(OptionIndex);
+			}
+		}
+	}
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTimeSeconds - GarbageCollectionSeconds;
+
+	OutReport.StepsPerSecond = ElapsedSeconds > 0.0 ? OutReport.NumSteps / ElapsedSeconds : 0.0;
+	OutReport.NumVisitedNodes = VisitedNodeIndices.Num();
+	OutReport.Coverage = OutReport.NumNodes > 0 ? 100.f * OutReport.NumVisitedNodes / OutReport.NumNodes : 100.f;
+	for (int32 NodeIndex = 0; NodeIndex < OutReport.NumNodes; NodeIndex++)
+	{
+		if (!VisitedNodeIndices.Contains(NodeIndex))
+		{
+			OutReport.UnvisitedNodeIndices.Add(NodeIndex);
+		}
+	}
+	OutReport.DeadEndNodeIndices = DeadEndNodeIndices.Array();
+	OutReport.DeadEndNodeIndices.Sort();
+}
+
+UDlgContext* UDlgExplorePathsCommandlet::ReplayPath(
+	UDlgDialogue& Dialogue,
+	int32 DialogueSeed,
+	const TArray<int32>& Options,
+	bool& bOutEnded,
+	FDlgExplorePathsDialogueReport& OutReport
+)
+{
+	// Every path starts from the same state
+	FDlgMemory::Get().Empty();
+	TMap<FName, UObject*> Participants;
+	for (const FName& ParticipantName : Dialogue.GetParticipantNames())
+	{
+		UDlgMockParticipant* Participant = NewObject<UDlgMockParticipant>(GetTransientPackage());
+		Participant->Initialize(ParticipantName, bRandomValues, HashCombine(DialogueSeed, GetTypeHash(ParticipantName)));
+		Participants.Add(ParticipantName, Participant);
+	}
+
+	// The random selectors pick the same options on every replay
+	UDlgContext* Context = NewObject<UDlgContext>(GetTransientPackage());
+	Context->SetRandomSeed(DialogueSeed);
+	if (!Context->StartWithContext(TEXT("ExplorePaths"), &Dialogue, Participants))
+	{
+		return nullptr;
+	}
+
+	bOutEnded = false;
+	for (const int32 OptionIndex : Options)
+	{
+		const int32 NodeIndex = Context->GetActiveNodeIndex();
+		const double StepStartSeconds = FPlatformTime::Seconds();
+		const bool bChosen = Context->ChooseOption(OptionIndex);
+		const double StepMs = (FPlatformTime::Seconds() - StepStartSeconds) * 1000.0;
+
+		OutReport.NumSteps++;
+		if (StepMs > OutReport.SlowestStepMs)
+		{
+			OutReport.SlowestStepMs = StepMs;
+			OutReport.SlowestStepNodeIndex = NodeIndex;
+		}
+		if (!bChosen)
+		{
+			bOutEnded = true;
+			break;
+		}
+	}
+
+	return Context;
+}
@@ -0,0 +1,185 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "Math/RandomStream.h"
+#include "DlgSystem/DlgDialogueParticipant.h"
+
+#include "DlgExplorePathsCommandlet.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgExplorePathsCommandlet, All, All);
+
+class UDlgDialogue;
+class UDlgContext;
+
+
+// Participant used by the UDlgExplorePathsCommandlet instead of the real game participants
+// The values modified by the events are recorded, the unknown values are either the defaults or random.
+UCLASS()
+class UDlgMockParticipant : public UObject, public IDlgDialogueParticipant
+{
+	GENERATED_BODY()
+
+public:
+	void Initialize(FName InParticipantName, bool bInRandomValues, int32 Seed)
+	{
+		ParticipantName = InParticipantName;
+		bRandomValues = bInRandomValues;
+		RandomStream.Initialize(Seed);
+	}
+
+	//~ IDlgDialogueParticipant interface
+	FName GetParticipantName_Implementation() const override { return ParticipantName; }
+	FText GetParticipantDisplayName_Implementation(FName ActiveSpeaker) const override { return FText::FromName(ParticipantName); }
+	ETextGender GetParticipantGender_Implementation() const override { return ETextGender::Neuter; }
+	UTexture2D* GetParticipantIcon_Implementation(FName ActiveSpeaker, FName ActiveSpeakerState) const override { return nullptr; }
+
+	bool CheckCondition_Implementation(const UDlgContext* Context, FName ConditionName) const override;
+	float GetFloatValue_Implementation(FName ValueName) const override;
+	int32 GetIntValue_Implementation(FName ValueName) const override;
+	bool GetBoolValue_Implementation(FName ValueName) const override;
+	FName GetNameValue_Implementation(FName ValueName) const override;
+
+	bool OnDialogueEvent_Implementation(UDlgContext* Context, FName EventName) override { return false; }
+	bool ModifyFloatValue_Implementation(FName ValueName, bool bDelta, float Value) override;
+	bool ModifyIntValue_Implementation(FName ValueName, bool bDelta, int32 Value) override;
+	bool ModifyBoolValue_Implementation(FName ValueName, bool bNewValue) override;
+	bool ModifyNameValue_Implementation(FName ValueName, FName NameValue) override;
+
+protected:
+	FName ParticipantName;
+
+	// Should the values not yet recorded be random? Otherwise they are the defaults (the conditions are satisfied)
+	bool bRandomValues = false;
+
+	// The random values are recorded as well, so they stay the same for the rest of the path
+	mutable FRandomStream RandomStream;
+	mutable TMap<FName, bool> Conditions;
+	mutable TMap<FName, float> FloatValues;
+	mutable TMap<FName, int32> IntValues;
+	mutable TMap<FName, bool> BoolValues;
+	mutable TMap<FName, FName> NameValues;
+};
+
+
+USTRUCT()
+struct FDlgExplorePathsDialogueReport
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UPROPERTY()
+	FString DialoguePath;
+
+	UPROPERTY()
+	int32 NumNodes = 0;
+
+	UPROPERTY()
+	int32 NumVisitedNodes = 0;
+
+	// Percentage of the visited nodes
+	UPROPERTY()
+	float Coverage = 0.f;
+
+	UPROPERTY()
+	TArray<int32> UnvisitedNodeIndices;
+
+	// Number of explored paths, each option of a node is only explored once
+	UPROPERTY()
+	int32 NumPaths = 0;
+
+	// Paths that ended in an End node
+	UPROPERTY()
+	int32 NumEnds = 0;
+
+	// The nodes where a path ended without an End node (no satisfied child or an error)
+	UPROPERTY()
+	TArray<int32> DeadEndNodeIndices;
+
+	// Paths not explored further because they reached the MaxDepth
+	UPROPERTY()
+	int32 NumTruncatedPaths = 0;
+
+	// The most options a node had
+	UPROPERTY()
+	int32 MaxOptions = 0;
+
+	UPROPERTY()
+	int32 NumSteps = 0;
+
+	UPROPERTY()
+	double StepsPerSecond = 0.0;
+
+	// The most expensive single step, usually a deep selector chain or a huge fan-out
+	UPROPERTY()
+	double SlowestStepMs = 0.0;
+
+	UPROPERTY()
+	int32 SlowestStepNodeIndex = INDEX_NONE;
+};
+
+
+USTRUCT()
+struct FDlgExplorePathsReport
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UPROPERTY()
+	int32 Shard = 0;
+
+	UPROPERTY()
+	int32 NumShards = 1;
+
+	UPROPERTY()
+	int32 NumSteps = 0;
+
+	UPROPERTY()
+	double StepsPerSecond = 0.0;
+
+	UPROPERTY()
+	TArray<FDlgExplorePathsDialogueReport> Dialogues;
+};
+
+
+/**
+ * Drives every Dialogue through its reachable option paths with mock participants and writes a JSON report
+ * about the coverage, dead ends and throughput.
+ *
+ * Params:
+ *   -Output=<Path>            The JSON file, relative to the project directory. Default: Saved/DlgExplorePaths.json
+ *   -MaxDepth=<N>             Maximum number of options chosen on a single path. Default: 64
+ *   -MaxPaths=<N>             Maximum number of paths for a single Dialogue. Default: 10000
+ *   -Seed=<N>                 Seed of the random values
+ *   -RandomValues             The mock participants return random values instead of the defaults
+ *   -Shard=<I> -NumShards=<N> Only explore every Nth Dialogue, run multiple processes to explore in parallel
+ *   -GCPaths=<N>              Collect the garbage (contexts and mock participants) every N paths. Default: 1000
+ */
+UCLASS()
+class UDlgExplorePathsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDlgExplorePathsCommandlet();
+
+	//~ UCommandlet interface
+	int32 Main(const FString& Params) override;
+
+	void ExploreDialogue(UDlgDialogue& Dialogue, int32 DialogueSeed, FDlgExplorePathsDialogueReport& OutReport);
+
+protected:
+	// Starts a new context with fresh mock participants and chooses the Options one by one
+	// @return the context or nullptr if the start failed, bOutEnded is true if the last option ended the Dialogue
+	UDlgContext* ReplayPath(UDlgDialogue& Dialogue, int32 DialogueSeed, const TArray<int32>& Options, bool& bOutEnded, FDlgExplorePathsDialogueReport& OutReport);
+
+protected:
+	int32 MaxDepth = 64;
+	int32 MaxPaths = 10000;
+	int32 CollectGarbageEveryNumPaths = 1000;
+	bool bRandomValues = false;
+
+	// Keeps the Dialogues alive while the garbage of the replayed paths is collected
+	UPROPERTY(Transient)
+	TArray<UDlgDialogue*> ExploredDialogues;
+};
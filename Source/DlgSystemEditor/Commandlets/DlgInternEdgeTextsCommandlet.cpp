@@ -0,0 +1,104 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgInternEdgeTextsCommandlet.h"
+
+#include "UObject/Package.h"
+#include "FileHelpers.h"
+#include "Internationalization/StringTable.h"
+
+#include "DlgSystem/DlgManager.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/DlgHelper.h"
+#include "DlgSystem/DlgSystemSettings.h"
+#include "DlgSystem/Nodes/DlgNode.h"
+
+DEFINE_LOG_CATEGORY(LogDlgInternEdgeTextsCommandlet);
+
+
+UDlgInternEdgeTextsCommandlet::UDlgInternEdgeTextsCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UDlgInternEdgeTextsCommandlet::Main(const FString& Params)
+{
+	UE_LOG(LogDlgInternEdgeTextsCommandlet, Display, TEXT("Starting"));
+
+	// Parse command line - we're interested in the param vals
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	UCommandlet::ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+	const bool bDryRun = Switches.Contains(TEXT("DryRun"));
+
+	const UDlgSystemSettings* Settings = GetDefault<UDlgSystemSettings>();
+	if (Settings->EdgeTextsStringTable.IsNull())
+	{
+		UE_LOG(LogDlgInternEdgeTextsCommandlet, Error, TEXT("The Edge Texts String Table is not set in the Dialogue System settings"));
+		return -1;
+	}
+
+	UStringTable* StringTable = Cast<UStringTable>(Settings->EdgeTextsStringTable.TryLoad());
+	if (!StringTable)
+	{
+		UE_LOG(LogDlgInternEdgeTextsCommandlet, Error, TEXT("Edge Texts String Table = `%s` is not a valid String Table"), *Settings->EdgeTextsStringTable.ToString());
+		return -1;
+	}
+
+	UDlgManager::LoadAllDialoguesIntoMemory();
+	const TArray<UDlgDialogue*> AllDialogues = UDlgManager::GetAllDialoguesFromMemory();
+
+	TArray<UPackage*> PackagesToSave;
+	for (UDlgDialogue* Dialogue : AllDialogues)
+	{
+		// Only intern game dialogues
+		const FString DialoguePath = Dialogue->GetOutermost()->GetPathName();
+		if (!FDlgHelper::IsPathInProjectDirectory(DialoguePath))
+		{
+			UE_LOG(LogDlgInternEdgeTextsCommandlet, Warning, TEXT("Dialogue = `%s` is not in the game directory, ignoring"), *DialoguePath);
+			continue;
+		}
+
+		TArray<UDlgNode*> Nodes = Dialogue->GetNodes();
+		Nodes.Append(Dialogue->GetMutableStartNodes());
+
+		bool bInterned = false;
+		for (UDlgNode* Node : Nodes)
+		{
+			if (IsValid(Node))
+			{
+				bInterned |= Node->InternEdgeTextsIntoStringTable(*StringTable);
+			}
+		}
+
+		if (bInterned)
+		{
+			UE_LOG(LogDlgInternEdgeTextsCommandlet, Display, TEXT("Interned the edge texts of Dialogue = `%s`"), *DialoguePath);
+			Dialogue->Modify();
+			Dialogue->MarkPackageDirty();
+			PackagesToSave.Add(Dialogue->GetOutermost());
+		}
+	}
+
+	if (PackagesToSave.Num() == 0)
+	{
+		UE_LOG(LogDlgInternEdgeTextsCommandlet, Display, TEXT("All the edge texts are already interned"));
+		return 0;
+	}
+
+	// The String Table must be saved with the Dialogues referencing its new entries
+	StringTable->MarkPackageDirty();
+	PackagesToSave.Add(StringTable->GetOutermost());
+
+	UE_LOG(LogDlgInternEdgeTextsCommandlet, Display, TEXT("Interned the edge texts of %d Dialogues into String Table = `%s`"),
+		PackagesToSave.Num() - 1, *StringTable->GetPathName());
+	if (bDryRun)
+	{
+		return 0;
+	}
+
+	return UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, false) ? 0 : -1;
+}
@@ -0,0 +1,28 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "DlgInternEdgeTextsCommandlet.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgInternEdgeTextsCommandlet, All, All);
+
+
+/**
+ * Interns the edge texts of all the Dialogues into the Edge Texts String Table of the settings, see FDlgLocalizationHelper::InternTextIntoStringTable.
+ * The modified Dialogues are saved together with the String Table, so the saved Dialogues never refer to missing entries.
+ *
+ * Params:
+ *   -DryRun    Only reports the number of the texts that would be interned, nothing is saved
+ */
+UCLASS()
+class UDlgInternEdgeTextsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDlgInternEdgeTextsCommandlet();
+
+	//~ UCommandlet interface
+	int32 Main(const FString& Params) override;
+};
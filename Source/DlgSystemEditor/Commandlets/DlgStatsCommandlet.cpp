@@ -1,17 +1,161 @@
 // Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
 
 #include "DlgStatsCommandlet.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
 #include "DlgSystem/DlgManager.h"
 #include "DlgSystem/DlgDialogue.h"
 #include "DlgCommandletHelper.h"
 #include "DlgSystem/Nodes/DlgNode_SpeechSequence.h"
 #include "DlgSystem/Nodes/DlgNode_Speech.h"
+#include "DlgSystem/Nodes/DlgNode_Selector.h"
+#include "DlgSystem/Nodes/DlgNode_Proxy.h"
+#include "DlgSystem/DlgConditionCustom.h"
 #include "DlgSystem/DlgHelper.h"
+#include "DlgSystem/NYEngineVersionHelpers.h"
+#include "DlgSystem/IO/DlgJsonWriter.h"
 
 
 DEFINE_LOG_CATEGORY(LogDlgStatsCommandlet);
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tarjan's strongly connected components over the hop nodes (selectors, proxies and virtual parents)
+// The members of a cycle get the same depth: each member is counted once, then the chain continues in the deepest node after the cycle
+class FDlgHopChainSearch
+{
+public:
+	FDlgHopChainSearch(const UDlgDialogue& InDialogue, FDlgHopChainDepths& InHopChainDepths)
+		: Dialogue(InDialogue), HopChainDepths(InHopChainDepths) {}
+
+	static bool IsHopNode(const UDlgNode* Node)
+	{
+		const UDlgNode_Speech* NodeSpeech = Cast<UDlgNode_Speech>(Node);
+		return (NodeSpeech && NodeSpeech->IsVirtualParent()) || Node->IsA<UDlgNode_Proxy>() || Node->IsA<UDlgNode_Selector>();
+	}
+
+	// The nodes entered right after the Node, INDEX_NONE and null targets are ignored
+	TArray<const UDlgNode*> GetTargets(const UDlgNode* Node) const
+	{
+		const TArray<UDlgNode*>& Nodes = Dialogue.GetNodes();
+		TArray<const UDlgNode*> Targets;
+		if (const UDlgNode_Proxy* NodeProxy = Cast<UDlgNode_Proxy>(Node))
+		{
+			const int32 TargetIndex = NodeProxy->GetTargetNodeIndex();
+			if (Nodes.IsValidIndex(TargetIndex) && Nodes[TargetIndex])
+			{
+				Targets.Add(Nodes[TargetIndex]);
+			}
+			return Targets;
+		}
+
+		for (const FDlgEdge& Edge : Node->GetNodeChildren())
+		{
+			if (Nodes.IsValidIndex(Edge.TargetIndex) && Nodes[Edge.TargetIndex])
+			{
+				Targets.AddUnique(Nodes[Edge.TargetIndex]);
+			}
+		}
+		return Targets;
+	}
+
+	void Visit(const UDlgNode* Node)
+	{
+		if (!IsHopNode(Node))
+		{
+			HopChainDepths.Depths.Add(Node, 0);
+			return;
+		}
+
+		Indices.Add(Node, NextIndex);
+		LowLinks.Add(Node, NextIndex);
+		NextIndex++;
+		Stack.Push(Node);
+
+		const TArray<const UDlgNode*> Targets = GetTargets(Node);
+		for (const UDlgNode* Target : Targets)
+		{
+			if (HopChainDepths.Depths.Contains(Target))
+			{
+				// Already done
+				continue;
+			}
+
+			if (const int32* TargetIndex = Indices.Find(Target))
+			{
+				// Still on the stack, part of the same component
+				LowLinks[Node] = FMath::Min(LowLinks[Node], *TargetIndex);
+			}
+			else
+			{
+				Visit(Target);
+				if (const int32* TargetLowLink = LowLinks.Find(Target))
+				{
+					LowLinks[Node] = FMath::Min(LowLinks[Node], *TargetLowLink);
+				}
+			}
+		}
+
+		// Not the root of its component
+		if (LowLinks[Node] != Indices[Node])
+		{
+			return;
+		}
+
+		TArray<const UDlgNode*> Component;
+		const UDlgNode* Member = nullptr;
+		do
+		{
+			Member = Stack.Pop();
+			Component.Add(Member);
+		}
+		while (Member != Node);
+
+		// The nodes after the component are done, the depths inside it are not set yet
+		int32 MaxTargetDepth = 0;
+		bool bCycle = Component.Num() > 1;
+		for (const UDlgNode* ComponentNode : Component)
+		{
+			for (const UDlgNode* Target : GetTargets(ComponentNode))
+			{
+				if (Component.Contains(Target))
+				{
+					bCycle = true;
+				}
+				else
+				{
+					MaxTargetDepth = FMath::Max(MaxTargetDepth, HopChainDepths.Depths.FindChecked(Target));
+				}
+			}
+		}
+
+		const int32 Depth = Component.Num() + MaxTargetDepth;
+		for (const UDlgNode* ComponentNode : Component)
+		{
+			HopChainDepths.Depths.Add(ComponentNode, Depth);
+			if (bCycle)
+			{
+				HopChainDepths.CyclicNodes.Add(ComponentNode);
+			}
+			Indices.Remove(ComponentNode);
+			LowLinks.Remove(ComponentNode);
+		}
+	}
+
+protected:
+	const UDlgDialogue& Dialogue;
+	FDlgHopChainDepths& HopChainDepths;
+
+	// Only the nodes on the Stack are in these
+	TMap<const UDlgNode*, int32> Indices;
+	TMap<const UDlgNode*, int32> LowLinks;
+	TArray<const UDlgNode*> Stack;
+	int32 NextIndex = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 UDlgStatsCommandlet::UDlgStatsCommandlet()
 {
 	IsClient = false;
@@ -31,10 +175,34 @@ int32 UDlgStatsCommandlet::Main(const FString& Params)
 	TMap<FString, FString> ParamVals;
 	UCommandlet::ParseCommandLine(*Params, Tokens, Switches, ParamVals);
 
+	// Set the output file, nothing is written without one
+	FString OutputPath;
+	if (const FString* OutputVal = ParamVals.Find(TEXT("Output")))
+	{
+		OutputPath = *OutputVal;
+		if (FPaths::IsRelative(OutputPath))
+		{
+			OutputPath = FPaths::Combine(FPaths::ProjectDir(), OutputPath);
+		}
+	}
+	bool bJSON = FPaths::GetExtension(OutputPath).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	if (const FString* FormatVal = ParamVals.Find(TEXT("Format")))
+	{
+		bJSON = FormatVal->Equals(TEXT("JSON"), ESearchCase::IgnoreCase);
+	}
+	const bool bCompaction = Switches.Contains(TEXT("Compaction"));
+	if (const FString* GCCopiesVal = ParamVals.Find(TEXT("GCCopies")))
+	{
+		CollectGarbageEveryNumCopies = FMath::Max(1, FCString::Atoi(**GCCopiesVal));
+	}
+
 	UDlgManager::LoadAllDialoguesIntoMemory();
 	const TArray<UDlgDialogue*> AllDialogues = UDlgManager::GetAllDialoguesFromMemory();
 
 	FDlgStatsDialogue TotalStats;
+	FDlgStatsReport Report;
+	int64 TotalCompactionSavedBytes = 0;
+	int32 NumCompactionCopies = 0;
 	for (const UDlgDialogue* Dialogue : AllDialogues)
 	{
 		UPackage* Package = Dialogue->GetOutermost();
@@ -51,36 +219,240 @@ int32 UDlgStatsCommandlet::Main(const FString& Params)
 		FDlgStatsDialogue DialogueStats;
 		GetStatsForDialogue(*Dialogue, DialogueStats);
 		TotalStats += DialogueStats;
-		UE_LOG(LogDlgStatsCommandlet, Display, TEXT("Dialogue = %s. Total Text Word count = %d"), *OriginalDialoguePath, DialogueStats.WordCount);
+		for (FDlgStatsNode& NodeStats : DialogueStats.Nodes)
+		{
+			NodeStats.DialoguePath = OriginalDialoguePath;
+		}
+		Report.Nodes.Append(DialogueStats.Nodes);
+
+		UE_LOG(LogDlgStatsCommandlet, Display,
+			TEXT("Dialogue = %s. Total Text Word count = %d, Conditions per reevaluate = %d, Max fan-out = %d, Max hop chain depth = %d"),
+			*OriginalDialoguePath, DialogueStats.WordCount, DialogueStats.NumConditionsPerReevaluate, DialogueStats.MaxFanOut, DialogueStats.MaxHopChainDepth
+		);
+
+		if (bCompaction)
+		{
+			// Compact a copy, the original is still used by the editor
+			// The copy is transient, it keeps the GUID of the original, see UDlgDialogue::PostDuplicate
+			FObjectDuplicationParameters DuplicationParameters = InitStaticDuplicateObjectParams(Dialogue, GetTransientPackage());
+			DuplicationParameters.ApplyFlags |= RF_Transient;
+			UDlgDialogue* DialogueCopy = CastChecked<UDlgDialogue>(StaticDuplicateObjectEx(DuplicationParameters));
+			const int64 SavedBytes = DialogueCopy->CompactRuntimeData(true);
+			TotalCompactionSavedBytes += SavedBytes;
+			UE_LOG(LogDlgStatsCommandlet, Display, TEXT("Dialogue = %s. Compaction saves %lld bytes"), *OriginalDialoguePath, SavedBytes);
+
+			// Only the measurement was needed
+#if NY_ENGINE_VERSION >= 500
+			DialogueCopy->MarkAsGarbage();
+#else
+			DialogueCopy->MarkPendingKill();
+#endif
+			NumCompactionCopies++;
+			if (NumCompactionCopies % CollectGarbageEveryNumCopies == 0)
+			{
+				CollectGarbage(RF_NoFlags);
+			}
+		}
 	}
 
 	UE_LOG(LogDlgStatsCommandlet, Display,
 		LINE_TERMINATOR TEXT("Stats:") LINE_TERMINATOR
-		TEXT("Total Text Word Count = %d"),
-		TotalStats.WordCount);
+		TEXT("Total Text Word Count = %d") LINE_TERMINATOR
+		TEXT("Total Conditions per reevaluate = %d") LINE_TERMINATOR
+		TEXT("Max fan-out = %d") LINE_TERMINATOR
+		TEXT("Max hop chain depth = %d"),
+		TotalStats.WordCount, TotalStats.NumConditionsPerReevaluate, TotalStats.MaxFanOut, TotalStats.MaxHopChainDepth);
+	if (bCompaction)
+	{
+		UE_LOG(LogDlgStatsCommandlet, Display, TEXT("Total compaction savings = %lld bytes"), TotalCompactionSavedBytes);
+	}
+
+	if (OutputPath.IsEmpty())
+	{
+		return 0;
+	}
+
+	// Most expensive nodes first
+	Report.Nodes.Sort([](const FDlgStatsNode& A, const FDlgStatsNode& B)
+	{
+		return A.NumConditionsPerReevaluate > B.NumConditionsPerReevaluate;
+	});
+
+	bool bWritten = false;
+	if (bJSON)
+	{
+		FDlgJsonWriter JsonWriter;
+		JsonWriter.Write(FDlgStatsReport::StaticStruct(), &Report);
+		bWritten = JsonWriter.ExportToFile(OutputPath);
+	}
+	else
+	{
+		bWritten = WriteCSV(OutputPath, Report.Nodes);
+	}
 
+	if (!bWritten)
+	{
+		UE_LOG(LogDlgStatsCommandlet, Error, TEXT("FAILED to write file = `%s`"), *OutputPath);
+		return -1;
+	}
+
+	UE_LOG(LogDlgStatsCommandlet, Display, TEXT("Writing the stats of %d nodes to file = `%s`"), Report.Nodes.Num(), *OutputPath);
 	return 0;
 }
 
 
 bool UDlgStatsCommandlet::GetStatsForDialogue(const UDlgDialogue& Dialogue, FDlgStatsDialogue& OutStats)
 {
+	FDlgHopChainDepths HopChainDepths;
+	auto AddNodeStats = [this, &Dialogue, &HopChainDepths, &OutStats](const UDlgNode& Node, int32 NodeIndex)
+	{
+		FDlgStatsNode& NodeStats = OutStats.Nodes.AddDefaulted_GetRef();
+		GetNodeStats(Dialogue, Node, HopChainDepths, NodeStats);
+		NodeStats.NodeIndex = NodeIndex;
+		if (NodeIndex == INDEX_NONE)
+		{
+			NodeStats.NodeType = TEXT("Start");
+		}
+
+		OutStats.WordCount += NodeStats.WordCount;
+		OutStats.NumConditionsPerReevaluate += NodeStats.NumConditionsPerReevaluate;
+		OutStats.MaxFanOut = FMath::Max(OutStats.MaxFanOut, NodeStats.FanOut);
+		OutStats.MaxHopChainDepth = FMath::Max(OutStats.MaxHopChainDepth, NodeStats.HopChainDepth);
+	};
+
 	// Root
 	for (const UDlgNode* StartNode : Dialogue.GetStartNodes())
 	{
-		OutStats.WordCount += GetNodeWordCount(*StartNode);
+		if (StartNode)
+		{
+			AddNodeStats(*StartNode, INDEX_NONE);
+		}
 	}
 
 	// Nodes
 	const TArray<UDlgNode*>& Nodes = Dialogue.GetNodes();
 	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); NodeIndex++)
 	{
-		OutStats.WordCount += GetNodeWordCount(*Nodes[NodeIndex]);
+		if (Nodes[NodeIndex])
+		{
+			AddNodeStats(*Nodes[NodeIndex], NodeIndex);
+		}
 	}
 
 	return true;
 }
 
+void UDlgStatsCommandlet::GetNodeStats(const UDlgDialogue& Dialogue, const UDlgNode& Node, FDlgHopChainDepths& HopChainDepths, FDlgStatsNode& OutStats) const
+{
+	const TArray<UDlgNode*>& Nodes = Dialogue.GetNodes();
+	const TArray<FDlgEdge>& Children = Node.GetNodeChildren();
+
+	OutStats.NodeType = Node.GetNodeTypeString();
+	OutStats.FanOut = Children.Num();
+	OutStats.NumEnterConditions = Node.GetNodeEnterConditions().Num();
+	OutStats.NumTextArguments = Node.GetTextArguments().Num();
+	OutStats.HopChainDepth = GetHopChainDepth(Dialogue, &Node, HopChainDepths);
+	OutStats.bInHopCycle = HopChainDepths.CyclicNodes.Contains(&Node);
+	OutStats.WordCount = GetNodeWordCount(Node);
+
+	// ReevaluateOptions checks every edge and the enter conditions of its target
+	for (const FDlgEdge& Edge : Children)
+	{
+		OutStats.NumEdgeConditions += Edge.Conditions.Num();
+		OutStats.NumTextArguments += Edge.GetTextArguments().Num();
+		for (const FDlgCondition& Condition : Edge.Conditions)
+		{
+			AddConditionStats(Condition, OutStats);
+		}
+
+		if (Nodes.IsValidIndex(Edge.TargetIndex) && Nodes[Edge.TargetIndex])
+		{
+			for (const FDlgCondition& Condition : Nodes[Edge.TargetIndex]->GetNodeEnterConditions())
+			{
+				AddConditionStats(Condition, OutStats);
+			}
+		}
+	}
+}
+
+void UDlgStatsCommandlet::AddConditionStats(const FDlgCondition& Condition, FDlgStatsNode& OutStats)
+{
+	OutStats.NumConditionsPerReevaluate++;
+	switch (Condition.ConditionType)
+	{
+		case EDlgConditionType::IntCall:
+		case EDlgConditionType::FloatCall:
+		case EDlgConditionType::BoolCall:
+		case EDlgConditionType::NameCall:
+		case EDlgConditionType::EventCall:
+			OutStats.NumInterfaceConditions++;
+			break;
+
+		case EDlgConditionType::ClassIntVariable:
+		case EDlgConditionType::ClassFloatVariable:
+		case EDlgConditionType::ClassBoolVariable:
+		case EDlgConditionType::ClassNameVariable:
+			OutStats.NumClassVariableConditions++;
+			break;
+
+		case EDlgConditionType::WasNodeVisited:
+		case EDlgConditionType::HasSatisfiedChild:
+			OutStats.NumGraphConditions++;
+			break;
+
+		case EDlgConditionType::Custom:
+			OutStats.NumCustomConditions++;
+			if (Condition.CustomCondition && !Condition.CustomCondition->GetClass()->HasAnyClassFlags(CLASS_Native))
+			{
+				OutStats.NumBlueprintCustomConditions++;
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+int32 UDlgStatsCommandlet::GetHopChainDepth(const UDlgDialogue& Dialogue, const UDlgNode* Node, FDlgHopChainDepths& HopChainDepths)
+{
+	if (!Node)
+	{
+		return 0;
+	}
+	if (const int32* Depth = HopChainDepths.Depths.Find(Node))
+	{
+		return *Depth;
+	}
+
+	FDlgHopChainSearch Search(Dialogue, HopChainDepths);
+	Search.Visit(Node);
+	return HopChainDepths.Depths.FindChecked(Node);
+}
+
+FString UDlgStatsCommandlet::QuoteCSV(const FString& Value)
+{
+	return TEXT("\"") + Value.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+}
+
+bool UDlgStatsCommandlet::WriteCSV(const FString& FilePath, const TArray<FDlgStatsNode>& Nodes)
+{
+	FString String = TEXT("DialoguePath,NodeIndex,NodeType,FanOut,NumEnterConditions,NumEdgeConditions,NumConditionsPerReevaluate,")
+		TEXT("NumInterfaceConditions,NumClassVariableConditions,NumCustomConditions,NumBlueprintCustomConditions,NumGraphConditions,")
+		TEXT("HopChainDepth,InHopCycle,NumTextArguments,WordCount") LINE_TERMINATOR;
+
+	for (const FDlgStatsNode& Node : Nodes)
+	{
+		String += FString::Printf(
+			TEXT("%s,%d,%s,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d") LINE_TERMINATOR,
+			*QuoteCSV(Node.DialoguePath), Node.NodeIndex, *QuoteCSV(Node.NodeType), Node.FanOut, Node.NumEnterConditions, Node.NumEdgeConditions,
+			Node.NumConditionsPerReevaluate, Node.NumInterfaceConditions, Node.NumClassVariableConditions, Node.NumCustomConditions,
+			Node.NumBlueprintCustomConditions, Node.NumGraphConditions, Node.HopChainDepth, Node.bInHopCycle ? 1 : 0, Node.NumTextArguments, Node.WordCount
+		);
+	}
+
+	return FFileHelper::SaveStringToFile(String, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
 int32 UDlgStatsCommandlet::GetNodeWordCount(const UDlgNode& Node) const
 {
 	const UDlgNode* NodePtr = &Node;
@@ -10,22 +10,132 @@ DECLARE_LOG_CATEGORY_EXTERN(LogDlgStatsCommandlet, All, All);
 
 class UDlgDialogue;
 class UDlgNode;
+struct FDlgCondition;
+
+
+// The evaluation cost of a single node
+USTRUCT()
+struct FDlgStatsNode
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UPROPERTY()
+	FString DialoguePath;
+
+	// INDEX_NONE for the start nodes
+	UPROPERTY()
+	int32 NodeIndex = INDEX_NONE;
+
+	UPROPERTY()
+	FString NodeType;
+
+	// Number of children (edges)
+	UPROPERTY()
+	int32 FanOut = 0;
+
+	UPROPERTY()
+	int32 NumEnterConditions = 0;
+
+	UPROPERTY()
+	int32 NumEdgeConditions = 0;
+
+	// The conditions evaluated by each ReevaluateOptions of this node: the edge conditions and the enter conditions of the children
+	UPROPERTY()
+	int32 NumConditionsPerReevaluate = 0;
+
+	// The NumConditionsPerReevaluate by type
+	// Dialogue value checks and named conditions, calls of the IDlgDialogueParticipant interface
+	UPROPERTY()
+	int32 NumInterfaceConditions = 0;
+
+	// Class variable checks, found by reflection
+	UPROPERTY()
+	int32 NumClassVariableConditions = 0;
+
+	// UDlgConditionCustom, the Blueprint ones are also counted in NumBlueprintCustomConditions
+	UPROPERTY()
+	int32 NumCustomConditions = 0;
+
+	UPROPERTY()
+	int32 NumBlueprintCustomConditions = 0;
+
+	// WasNodeVisited and HasSatisfiedChild
+	UPROPERTY()
+	int32 NumGraphConditions = 0;
+
+	// The longest chain of selectors, proxies and virtual parents entered when this node is entered
+	// The members of a cycle count each member once and all report the same depth
+	UPROPERTY()
+	int32 HopChainDepth = 0;
+
+	// Is this node part of a cycle of selectors, proxies and virtual parents?
+	UPROPERTY()
+	bool bInHopCycle = false;
+
+	// Of the node and its edges
+	UPROPERTY()
+	int32 NumTextArguments = 0;
+
+	UPROPERTY()
+	int32 WordCount = 0;
+};
+
+
+USTRUCT()
+struct FDlgStatsReport
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UPROPERTY()
+	TArray<FDlgStatsNode> Nodes;
+};
+
+
+// Memo of UDlgStatsCommandlet::GetHopChainDepth
+struct FDlgHopChainDepths
+{
+public:
+	TMap<const UDlgNode*, int32> Depths;
+
+	// The nodes that are part of a hop cycle
+	TSet<const UDlgNode*> CyclicNodes;
+};
 
 
 struct FDlgStatsDialogue
 {
 public:
 	int32 WordCount = 0;
+	int32 NumConditionsPerReevaluate = 0;
+	int32 MaxFanOut = 0;
+	int32 MaxHopChainDepth = 0;
+
+	// Only the nodes of this dialogue, not merged by the operator+=
+	TArray<FDlgStatsNode> Nodes;
 
 	FDlgStatsDialogue& operator+=(const FDlgStatsDialogue& Other)
 	{
 		WordCount += Other.WordCount;
+		NumConditionsPerReevaluate += Other.NumConditionsPerReevaluate;
+		MaxFanOut = FMath::Max(MaxFanOut, Other.MaxFanOut);
+		MaxHopChainDepth = FMath::Max(MaxHopChainDepth, Other.MaxHopChainDepth);
 		return *this;
 	}
 
 };
 
 
+/**
+ * Counts the words and reports the evaluation cost of each node.
+ *
+ * Params:
+ *   -Output=<Path>      Writes the node costs into this file, relative to the project directory
+ *   -Format=<CSV|JSON>  Format of the output file. Default: by the extension of the Output, otherwise CSV
+ *   -Compaction         Reports the memory saved by the compaction of the cooked Dialogues, see UDlgSystemSettings::bCompactCookedDialogues
+ *   -GCCopies=<N>       Collect the garbage (the compacted copies) every N Dialogues. Default: 100
+ */
 UCLASS()
 class UDlgStatsCommandlet: public UCommandlet
 {
@@ -42,7 +152,22 @@ public:
 	bool GetStatsForDialogue(const UDlgDialogue& Dialogue, FDlgStatsDialogue& OutStats);
 	int32 GetNodeWordCount(const UDlgNode& Node) const;
 
+	// Fills the cost of the Node, HopChainDepths is the memo of GetHopChainDepth
+	void GetNodeStats(const UDlgDialogue& Dialogue, const UDlgNode& Node, FDlgHopChainDepths& HopChainDepths, FDlgStatsNode& OutStats) const;
+	static void AddConditionStats(const FDlgCondition& Condition, FDlgStatsNode& OutStats);
+
+	// The longest chain of selectors, proxies and virtual parents starting from the Node, 0 if the Node is not one of them
+	// The cycles are found first (strongly connected components), so the depth does not depend on the order the nodes are visited
+	static int32 GetHopChainDepth(const UDlgDialogue& Dialogue, const UDlgNode* Node, FDlgHopChainDepths& HopChainDepths);
+
+	// Wraps the Value in quotes and doubles the quotes inside it, the paths can contain commas
+	static FString QuoteCSV(const FString& Value);
+	static bool WriteCSV(const FString& FilePath, const TArray<FDlgStatsNode>& Nodes);
+
 	int32 GetStringWordCount(const FString& String) const;
 	int32 GetFNameWordCount(const FName Name) const { return GetStringWordCount(Name.ToString()); }
 	int32 GetTextWordCount(const FText& Text) const { return GetStringWordCount(Text.ToString()); }
+
+protected:
+	int32 CollectGarbageEveryNumCopies = 100;
 };
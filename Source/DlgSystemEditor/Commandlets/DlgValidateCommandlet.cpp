@@ -0,0 +1,108 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgValidateCommandlet.h"
+
+#include "Misc/Paths.h"
+#include "HAL/PlatformTime.h"
+
+#include "DlgSystem/DlgManager.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/DlgHelper.h"
+#include "DlgSystem/IO/DlgJsonWriter.h"
+
+DEFINE_LOG_CATEGORY(LogDlgValidateCommandlet);
+
+
+UDlgValidateCommandlet::UDlgValidateCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UDlgValidateCommandlet::Main(const FString& Params)
+{
+	UE_LOG(LogDlgValidateCommandlet, Display, TEXT("Starting"));
+
+	// Parse command line - we're interested in the param vals
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	UCommandlet::ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	FString OutputPath;
+	if (const FString* OutputVal = ParamVals.Find(TEXT("Output")))
+	{
+		OutputPath = *OutputVal;
+		if (FPaths::IsRelative(OutputPath))
+		{
+			OutputPath = FPaths::Combine(FPaths::ProjectDir(), OutputPath);
+		}
+	}
+	const bool bWarningsAsErrors = Switches.Contains(TEXT("WarningsAsErrors"));
+
+	UDlgManager::LoadAllDialoguesIntoMemory();
+	const TArray<UDlgDialogue*> AllDialogues = UDlgManager::GetAllDialoguesFromMemory();
+
+	// The snapshots are the only part that touches the UObjects
+	FDlgValidateReport Report;
+	TArray<FDlgValidationSnapshot> Snapshots;
+	Snapshots.Reserve(AllDialogues.Num());
+	const uint64 SnapshotStartCycles = FPlatformTime::Cycles64();
+	for (const UDlgDialogue* Dialogue : AllDialogues)
+	{
+		// Only validate game dialogues
+		if (!FDlgHelper::IsPathInProjectDirectory(Dialogue->GetPathName()))
+		{
+			continue;
+		}
+
+		Snapshots.Add(FDlgValidationSnapshot::Create(*Dialogue));
+	}
+	Report.SnapshotMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SnapshotStartCycles);
+
+	const uint64 ValidationStartCycles = FPlatformTime::Cycles64();
+	TArray<FDlgValidationResult> Results = FDlgDialogueValidator::ValidateParallel(Snapshots);
+	Report.ValidationMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ValidationStartCycles);
+
+	Report.NumDialogues = Results.Num();
+	for (FDlgValidationResult& Result : Results)
+	{
+		for (const FString& Error : Result.Errors)
+		{
+			UE_LOG(LogDlgValidateCommandlet, Error, TEXT("Dialogue = `%s`: %s"), *Result.DialoguePath, *Error);
+		}
+		for (const FString& Warning : Result.Warnings)
+		{
+			UE_LOG(LogDlgValidateCommandlet, Warning, TEXT("Dialogue = `%s`: %s"), *Result.DialoguePath, *Warning);
+		}
+
+		Report.NumErrors += Result.Errors.Num();
+		Report.NumWarnings += Result.Warnings.Num();
+		if (Result.Errors.Num() > 0 || Result.Warnings.Num() > 0)
+		{
+			Report.Dialogues.Add(MoveTemp(Result));
+		}
+	}
+
+	UE_LOG(LogDlgValidateCommandlet, Display,
+		TEXT("Validated %d Dialogues: %d errors, %d warnings. Snapshots = %.2f ms, Validation = %.2f ms"),
+		Report.NumDialogues, Report.NumErrors, Report.NumWarnings, Report.SnapshotMs, Report.ValidationMs
+	);
+
+	if (!OutputPath.IsEmpty())
+	{
+		FDlgJsonWriter JsonWriter;
+		JsonWriter.Write(FDlgValidateReport::StaticStruct(), &Report);
+		if (!JsonWriter.ExportToFile(OutputPath))
+		{
+			UE_LOG(LogDlgValidateCommandlet, Error, TEXT("FAILED to write file = `%s`"), *OutputPath);
+			return -1;
+		}
+		UE_LOG(LogDlgValidateCommandlet, Display, TEXT("Report written to = `%s`"), *OutputPath);
+	}
+
+	const bool bFailed = Report.NumErrors > 0 || (bWarningsAsErrors && Report.NumWarnings > 0);
+	return bFailed ? 1 : 0;
+}
@@ -0,0 +1,59 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "DlgSystem/DlgDialogueValidator.h"
+
+#include "DlgValidateCommandlet.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgValidateCommandlet, All, All);
+
+
+USTRUCT()
+struct FDlgValidateReport
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UPROPERTY()
+	int32 NumDialogues = 0;
+
+	UPROPERTY()
+	int32 NumErrors = 0;
+
+	UPROPERTY()
+	int32 NumWarnings = 0;
+
+	// Time spent creating the snapshots on the game thread
+	UPROPERTY()
+	double SnapshotMs = 0.0;
+
+	// Wall time of the parallel validation
+	UPROPERTY()
+	double ValidationMs = 0.0;
+
+	// Only the Dialogues with errors or warnings
+	UPROPERTY()
+	TArray<FDlgValidationResult> Dialogues;
+};
+
+
+/**
+ * Validates all the Dialogues on the worker threads, see FDlgDialogueValidator. Meant to run on CI.
+ * Returns 1 if any Dialogue has errors (or warnings with -WarningsAsErrors), 0 otherwise.
+ *
+ * Params:
+ *   -Output=<Path>      Writes the JSON report into this file, relative to the project directory
+ *   -WarningsAsErrors   Fail on the warnings too (unreachable nodes)
+ */
+UCLASS()
+class UDlgValidateCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDlgValidateCommandlet();
+
+	//~ UCommandlet interface
+	int32 Main(const FString& Params) override;
+};
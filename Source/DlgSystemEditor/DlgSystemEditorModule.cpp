@@ -38,6 +38,7 @@
 #include "DlgSystem/DlgManager.h"
 #include "DlgSystem/IDlgSystemModule.h"
 #include "DlgSystem/DlgParticipantName.h"
+#include "DlgSystem/DlgParticipantCaller.h"
 
 #include "DlgSystem/IO/DlgConfigWriter.h"
 #include "DlgSystem/Logging/DlgLogger.h"
@@ -284,6 +285,11 @@ void FDlgSystemEditorModule::ShutdownModule()
 	{
 		FCoreDelegates::OnPostEngineInit.Remove(OnPostEngineInitHandle);
 	}
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(OnBlueprintCompiledHandle);
+		GEditor->OnBlueprintReinstanced().Remove(OnBlueprintReinstancedHandle);
+	}
 
 	UE_LOG(LogDlgSystemEditor, Log, TEXT("DlgSystemEditorModule: ShutdownModule"));
 }
@@ -332,10 +338,25 @@ void FDlgSystemEditorModule::HandleOnPostEngineInit()
 {
 	bIsEngineInitialized = true;
 	UE_LOG(LogDlgSystemEditor, Log, TEXT("DlgSystemEditorModule::HandleOnPostEngineInit"));
+
+	// GEditor only exists after the engine init
+	if (GEditor)
+	{
+		OnBlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &Self::HandleOnBlueprintChanged);
+		OnBlueprintReinstancedHandle = GEditor->OnBlueprintReinstanced().AddRaw(this, &Self::HandleOnBlueprintChanged);
+	}
 }
 
 void FDlgSystemEditorModule::HandleOnBeginPIE(bool bIsSimulating)
 {
+	// The participant Blueprints might have been recompiled since the last play
+	FDlgParticipantCaller::ClearCache();
+}
+
+void FDlgSystemEditorModule::HandleOnBlueprintChanged()
+{
+	// A participant Blueprint might override (or stop overriding) the native functions now
+	FDlgParticipantCaller::ClearCache();
 }
 
 void FDlgSystemEditorModule::HandleOnPostPIEStarted(bool bIsSimulating)
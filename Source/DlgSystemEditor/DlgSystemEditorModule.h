@@ -62,6 +62,7 @@ private:
 
 	// Handle PIE events
 	void HandleOnBeginPIE(bool bIsSimulating);
+	void HandleOnBlueprintChanged();
 	void HandleOnPostPIEStarted(bool bIsSimulating);
 	void HandleOnEndPIEHandle(bool bIsSimulating);
 	void HandleOnAssetRegistryFilesLoaded();
@@ -105,6 +106,8 @@ private:
 	FDelegateHandle OnBeginPIEHandle;
 	FDelegateHandle OnPostPIEStartedHandle; // after BeginPlay() has been called
 	FDelegateHandle OnEndPIEHandle;
+	FDelegateHandle OnBlueprintCompiledHandle;
+	FDelegateHandle OnBlueprintReinstancedHandle;
 
 	// Flags
 	bool bIsEngineInitialized = false;
@@ -114,3 +114,19 @@ TArray<FName> FDlgDetailsPanelUtils::GetDialogueSortedParticipantNames(UDlgDialo
 	FDlgHelper::SortDefault(ParticipantNames);
 	return ParticipantNames.Array();
 }
+
+void FDlgDetailsPanelUtils::UpdateAndRefreshDialogueData(UDlgDialogue* Dialogue, const TSharedRef<IPropertyHandle>& PropertyHandle)
+{
+	if (!Dialogue)
+	{
+		return;
+	}
+
+	if (UDialogueGraphNode* GraphNode = GetClosestGraphNodeFromPropertyHandle(PropertyHandle))
+	{
+		Dialogue->UpdateAndRefreshNodeData(GraphNode->GetMutableDialogueNode());
+		return;
+	}
+
+	Dialogue->UpdateAndRefreshData();
+}
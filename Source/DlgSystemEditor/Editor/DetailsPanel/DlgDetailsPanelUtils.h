@@ -70,6 +70,23 @@ public:
 		return GetDefault<UDlgSystemSettings>()->bShowGenericData ? EVisibility::Visible : EVisibility::Hidden;
 	}
 
+	// Only one of the hard and soft reference variants of the node assets is shown, depending on the settings
+	static EVisibility GetNodeAssetReferenceVisibility(EVisibility Visibility, bool bSoftReference)
+	{
+		if (GetDefault<UDlgSystemSettings>()->bUseSoftReferencesForNodeAssets != bSoftReference)
+		{
+			return EVisibility::Hidden;
+		}
+		return Visibility;
+	}
+
+	static EVisibility GetHardVoiceSoundWaveVisibility() { return GetNodeAssetReferenceVisibility(GetVoiceSoundWaveVisibility(), false); }
+	static EVisibility GetSoftVoiceSoundWaveVisibility() { return GetNodeAssetReferenceVisibility(GetVoiceSoundWaveVisibility(), true); }
+	static EVisibility GetHardVoiceDialogueWaveVisibility() { return GetNodeAssetReferenceVisibility(GetVoiceDialogueWaveVisibility(), false); }
+	static EVisibility GetSoftVoiceDialogueWaveVisibility() { return GetNodeAssetReferenceVisibility(GetVoiceDialogueWaveVisibility(), true); }
+	static EVisibility GetHardNodeGenericDataVisibility() { return GetNodeAssetReferenceVisibility(GetNodeGenericDataVisibility(), false); }
+	static EVisibility GetSoftNodeGenericDataVisibility() { return GetNodeAssetReferenceVisibility(GetNodeGenericDataVisibility(), true); }
+
 	static EVisibility GetChildrenVisibility()
 	{
 		return GetDefault<UDlgSystemSettings>()->bShowAdvancedChildren ? EVisibility::Visible : EVisibility::Hidden;
@@ -169,4 +186,10 @@ public:
 
 	/** Gets all the participant names of the Dialogue sorted alphabetically */
 	static TArray<FName> GetDialogueSortedParticipantNames(UDlgDialogue* Dialogue);
+
+	/**
+	 * Refreshes the data of the Dialogue after the property of the PropertyHandle changed.
+	 * Only the closest Node of the PropertyHandle is refreshed if there is one, otherwise the whole Dialogue.
+	 */
+	static void UpdateAndRefreshDialogueData(UDlgDialogue* Dialogue, const TSharedRef<IPropertyHandle>& PropertyHandle);
 };
@@ -22,6 +22,7 @@ void FDlgEdge_Details::CustomizeHeader(TSharedRef<IPropertyHandle> InStructPrope
 	StructPropertyHandle = InStructPropertyHandle;
 	Dialogue = FDlgDetailsPanelUtils::GetDialogueFromPropertyHandle(StructPropertyHandle.ToSharedRef());
 	bShowTextProperty = true;
+	bShowWeightProperty = false;
 
 	// Should we show hide the Text property?
 	if (const UDialogueGraphNode* GraphNode = FDlgDetailsPanelUtils::GetClosestGraphNodeFromPropertyHandle(StructPropertyHandle.ToSharedRef()))
@@ -29,6 +30,7 @@ void FDlgEdge_Details::CustomizeHeader(TSharedRef<IPropertyHandle> InStructPrope
 		// Virtual parents do not handle direct children, only grand children
 		// And selector node do not even touch them
 		bShowTextProperty = FDlgEdge::IsTextVisible(GraphNode->GetDialogueNode());
+		bShowWeightProperty = FDlgEdge::IsWeightVisible(GraphNode->GetDialogueNode());
 
 		// Special case
 		// Selector node but one of its parent is a virtual parent, allow text then
@@ -104,6 +106,14 @@ void FDlgEdge_Details::CustomizeChildren(TSharedRef<IPropertyHandle> InStructPro
 	);
 	BoolPropertyRow.Visibility(CREATE_VISIBILITY_CALLBACK(&Self::GetTextVisibility));
 
+	// Weight
+	StructBuilder.AddProperty(StructPropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FDlgEdge, Weight)).ToSharedRef())
+		.Visibility(CREATE_VISIBILITY_CALLBACK(&Self::GetWeightVisibility));
+	StructBuilder.AddProperty(StructPropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FDlgEdge, WeightParticipantName)).ToSharedRef())
+		.Visibility(CREATE_VISIBILITY_CALLBACK(&Self::GetWeightVisibility));
+	StructBuilder.AddProperty(StructPropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FDlgEdge, WeightFloatName)).ToSharedRef())
+		.Visibility(CREATE_VISIBILITY_CALLBACK(&Self::GetWeightVisibility));
+
 	// Node Data that can be anything set by the user
 	StructBuilder.AddProperty(StructPropertyHandle->GetChildHandle(FDlgEdge::GetMemberNameEdgeData()).ToSharedRef())
 		.Visibility(CREATE_VISIBILITY_CALLBACK_STATIC(&FDlgDetailsPanelUtils::GetEdgeDataVisibility))
@@ -113,20 +123,14 @@ void FDlgEdge_Details::CustomizeChildren(TSharedRef<IPropertyHandle> InStructPro
 
 void FDlgEdge_Details::HandleSpeakerStateCommitted(const FText& InSearchText, ETextCommit::Type CommitInfo)
 {
-	if (Dialogue)
-	{
-		Dialogue->UpdateAndRefreshData();
-	}
+	FDlgDetailsPanelUtils::UpdateAndRefreshDialogueData(Dialogue, StructPropertyHandle.ToSharedRef());
 }
 
 void FDlgEdge_Details::HandleTextCommitted(const FText& InText, ETextCommit::Type CommitInfo)
 {
 	if (UDialogueGraphNode_Edge* GraphEdge = FDlgDetailsPanelUtils::GetAsGraphNodeEdgeFromPropertyHandle(StructPropertyHandle.ToSharedRef()))
 	{
-		if (Dialogue)
-		{
-			Dialogue->UpdateAndRefreshData();
-		}
+		FDlgDetailsPanelUtils::UpdateAndRefreshDialogueData(Dialogue, StructPropertyHandle.ToSharedRef());
 
 		GraphEdge->GetDialogueEdge().RebuildTextArguments();
 	}
@@ -61,6 +61,7 @@ public:
 private:
 	// Getters for the visibility of some properties
 	EVisibility GetTextVisibility() const { return bShowTextProperty ? EVisibility::Visible : EVisibility::Hidden; }
+	EVisibility GetWeightVisibility() const { return bShowWeightProperty ? EVisibility::Visible : EVisibility::Collapsed; }
 
 	EVisibility GetSpeakerStateVisibility() const
 	{
@@ -79,6 +80,9 @@ private:
 	/** Bool flag indicating to show or not the Text Property of the Edge */
 	bool bShowTextProperty = true;
 
+	/** Only the edges of the weighted random selectors have a weight */
+	bool bShowWeightProperty = false;
+
 	/** Cache some properties */
 	TSharedPtr<IPropertyHandle> TextPropertyHandle;
 	TSharedPtr<FDlgMultiLineEditableTextBox_CustomRowHelper> TextPropertyRow;
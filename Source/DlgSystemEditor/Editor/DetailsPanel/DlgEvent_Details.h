@@ -122,10 +122,7 @@ private:
 	// Handler for when text in the editable text box changed
 	void HandleTextCommitted(const FText& InSearchText, ETextCommit::Type CommitInfo) const
 	{
-		if (Dialogue)
-		{
-			Dialogue->UpdateAndRefreshData();
-		}
+		FDlgDetailsPanelUtils::UpdateAndRefreshDialogueData(Dialogue, StructPropertyHandle.ToSharedRef());
 	}
 
 	// Gets all the event name suggestions depending on EventType from the current Dialogue
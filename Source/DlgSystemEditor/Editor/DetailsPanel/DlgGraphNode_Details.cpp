@@ -219,19 +219,31 @@ void FDlgGraphNode_Details::CustomizeDetails(IDetailLayoutBuilder& DetailBuilder
 		VoiceSoundWavePropertyRow = &SpeechDataCategory.AddProperty(
 			PropertyDialogueNode->GetChildHandle(UDlgNode_Speech::GetMemberNameVoiceSoundWave())
 		);
-		VoiceSoundWavePropertyRow->Visibility(CREATE_VISIBILITY_CALLBACK_STATIC(&FDlgDetailsPanelUtils::GetVoiceSoundWaveVisibility));
+		VoiceSoundWavePropertyRow->Visibility(CREATE_VISIBILITY_CALLBACK_STATIC(&FDlgDetailsPanelUtils::GetHardVoiceSoundWaveVisibility));
+		SoftVoiceSoundWavePropertyRow = &SpeechDataCategory.AddProperty(
+			PropertyDialogueNode->GetChildHandle(UDlgNode_Speech::GetMemberNameSoftVoiceSoundWave())
+		);
+		SoftVoiceSoundWavePropertyRow->Visibility(CREATE_VISIBILITY_CALLBACK_STATIC(&FDlgDetailsPanelUtils::GetSoftVoiceSoundWaveVisibility));
 
 		// DialogueWave
 		VoiceDialogueWavePropertyRow =  &SpeechDataCategory.AddProperty(
 			PropertyDialogueNode->GetChildHandle(UDlgNode_Speech::GetMemberNameVoiceDialogueWave())
 		);
-		VoiceDialogueWavePropertyRow->Visibility(CREATE_VISIBILITY_CALLBACK_STATIC(&FDlgDetailsPanelUtils::GetVoiceDialogueWaveVisibility));
+		VoiceDialogueWavePropertyRow->Visibility(CREATE_VISIBILITY_CALLBACK_STATIC(&FDlgDetailsPanelUtils::GetHardVoiceDialogueWaveVisibility));
+		SoftVoiceDialogueWavePropertyRow = &SpeechDataCategory.AddProperty(
+			PropertyDialogueNode->GetChildHandle(UDlgNode_Speech::GetMemberNameSoftVoiceDialogueWave())
+		);
+		SoftVoiceDialogueWavePropertyRow->Visibility(CREATE_VISIBILITY_CALLBACK_STATIC(&FDlgDetailsPanelUtils::GetSoftVoiceDialogueWaveVisibility));
 
 		// Generic Data, can be FMOD sound
 		GenericDataPropertyRow = &SpeechDataCategory.AddProperty(
 			PropertyDialogueNode->GetChildHandle(UDlgNode_Speech::GetMemberNameGenericData())
 		);
-		GenericDataPropertyRow->Visibility(CREATE_VISIBILITY_CALLBACK_STATIC(&FDlgDetailsPanelUtils::GetNodeGenericDataVisibility));
+		GenericDataPropertyRow->Visibility(CREATE_VISIBILITY_CALLBACK_STATIC(&FDlgDetailsPanelUtils::GetHardNodeGenericDataVisibility));
+		SoftGenericDataPropertyRow = &SpeechDataCategory.AddProperty(
+			PropertyDialogueNode->GetChildHandle(UDlgNode_Speech::GetMemberNameSoftGenericData())
+		);
+		SoftGenericDataPropertyRow->Visibility(CREATE_VISIBILITY_CALLBACK_STATIC(&FDlgDetailsPanelUtils::GetSoftNodeGenericDataVisibility));
 	}
 	else if (bIsSelectorNode)
 	{
@@ -55,13 +55,13 @@ private:
 	/** Handler for when text in the editable text box changed */
 	void HandleParticipantTextCommitted(const FText& InSearchText, ETextCommit::Type CommitInfo)
 	{
-		Dialogue->UpdateAndRefreshData();
+		Dialogue->UpdateAndRefreshNodeData(GraphNode ? GraphNode->GetMutableDialogueNode() : nullptr);
 	}
 
 	/** Handler for when the speaker state is changed */
 	void HandleSpeakerStateCommitted(const FText& InSearchText, ETextCommit::Type CommitInfo)
 	{
-		Dialogue->UpdateAndRefreshData();
+		Dialogue->UpdateAndRefreshNodeData(GraphNode ? GraphNode->GetMutableDialogueNode() : nullptr);
 	}
 
 	// The IsVirtualParent property changed
@@ -86,6 +86,9 @@ private:
 	IDetailPropertyRow* VoiceSoundWavePropertyRow = nullptr;
 	IDetailPropertyRow* VoiceDialogueWavePropertyRow = nullptr;
 	IDetailPropertyRow* GenericDataPropertyRow = nullptr;
+	IDetailPropertyRow* SoftVoiceSoundWavePropertyRow = nullptr;
+	IDetailPropertyRow* SoftVoiceDialogueWavePropertyRow = nullptr;
+	IDetailPropertyRow* SoftGenericDataPropertyRow = nullptr;
 	IDetailPropertyRow* ChildrenPropertyRow = nullptr;
 
 	/** The details panel layout builder reference. */
@@ -67,10 +67,7 @@ private:
 	/** Handler for when text in the editable text box changed */
 	void HandleTextCommitted(const FText& InSearchText, ETextCommit::Type CommitInfo) const
 	{
-		if (Dialogue)
-		{
-			Dialogue->UpdateAndRefreshData();
-		}
+		FDlgDetailsPanelUtils::UpdateAndRefreshDialogueData(Dialogue, StructPropertyHandle.ToSharedRef());
 	}
 
 private:
@@ -86,6 +83,9 @@ private:
 	IDetailPropertyRow* VoiceSoundWavePropertyRow = nullptr;
 	IDetailPropertyRow* VoiceDialogueWavePropertyRow = nullptr;
 	IDetailPropertyRow* GenericDataPropertyRow = nullptr;
+	IDetailPropertyRow* SoftVoiceSoundWavePropertyRow = nullptr;
+	IDetailPropertyRow* SoftVoiceDialogueWavePropertyRow = nullptr;
+	IDetailPropertyRow* SoftGenericDataPropertyRow = nullptr;
 	IDetailPropertyRow* NodeDataPropertyRow = nullptr;
 	TSharedPtr<FDlgMultiLineEditableTextBox_CustomRowHelper> TextPropertyRow;
 	TSharedPtr<FDlgMultiLineEditableTextBox_CustomRowHelper> EdgeTextPropertyRow;
@@ -9,9 +9,91 @@
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Root.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Edge.h"
 #include "DlgSystem/Nodes/DlgNode.h"
+#include "DlgSystem/Nodes/DlgNode_Proxy.h"
+#include "DlgSystem/Nodes/DlgNode_Selector.h"
+#include "DlgSystem/Nodes/DlgNode_Speech.h"
 #include "DlgSystem/DlgDialogue.h"
 #include "DlgSystem/DlgHelper.h"
 
+// Tarjan's algorithm, returns the strongly connected components of the graph given by its adjacency lists.
+// Iterative so that long chains of nodes do not overflow the stack.
+static TArray<TArray<int32>> GetStronglyConnectedComponents(const TArray<TArray<int32>>& Graph)
+{
+	const int32 NumVertices = Graph.Num();
+	TArray<int32> Indices;
+	TArray<int32> LowLinks;
+	TArray<bool> IsOnStack;
+	Indices.Init(INDEX_NONE, NumVertices);
+	LowLinks.Init(INDEX_NONE, NumVertices);
+	IsOnStack.Init(false, NumVertices);
+
+	TArray<int32> Stack;
+	TArray<TArray<int32>> Components;
+	int32 NextIndex = 0;
+
+	// Key: Vertex
+	// Value: Index of the next edge of the vertex to visit
+	TArray<TPair<int32, int32>> CallStack;
+	for (int32 Root = 0; Root < NumVertices; Root++)
+	{
+		if (Indices[Root] != INDEX_NONE)
+		{
+			continue;
+		}
+
+		Indices[Root] = LowLinks[Root] = NextIndex++;
+		Stack.Push(Root);
+		IsOnStack[Root] = true;
+		CallStack.Emplace(Root, 0);
+
+		while (CallStack.Num() > 0)
+		{
+			const int32 Vertex = CallStack.Last().Key;
+			const int32 EdgeIndex = CallStack.Last().Value;
+			if (Graph[Vertex].IsValidIndex(EdgeIndex))
+			{
+				CallStack.Last().Value++;
+				const int32 Child = Graph[Vertex][EdgeIndex];
+				if (Indices[Child] == INDEX_NONE)
+				{
+					Indices[Child] = LowLinks[Child] = NextIndex++;
+					Stack.Push(Child);
+					IsOnStack[Child] = true;
+					CallStack.Emplace(Child, 0);
+				}
+				else if (IsOnStack[Child])
+				{
+					LowLinks[Vertex] = FMath::Min(LowLinks[Vertex], Indices[Child]);
+				}
+				continue;
+			}
+
+			// All the edges are visited, return to the parent
+			CallStack.Pop();
+			if (CallStack.Num() > 0)
+			{
+				const int32 Parent = CallStack.Last().Key;
+				LowLinks[Parent] = FMath::Min(LowLinks[Parent], LowLinks[Vertex]);
+			}
+
+			// Root of a component
+			if (LowLinks[Vertex] == Indices[Vertex])
+			{
+				TArray<int32>& Component = Components.AddDefaulted_GetRef();
+				int32 Member = INDEX_NONE;
+				do
+				{
+					Member = Stack.Pop();
+					IsOnStack[Member] = false;
+					Component.Add(Member);
+				} while (Member != Vertex);
+			}
+		}
+	}
+
+	return Components;
+}
+
 void FDlgCompilerContext::Compile()
 {
 	check(Dialogue);
@@ -76,6 +158,9 @@ void FDlgCompilerContext::Compile()
 	// Step 6. Fix old indices and update GUID for the Conditions
 	FixBrokenOldIndicesAndUpdateGUID();
 
+	// Step 7. Warn about the chains of nodes that could loop forever
+	ReportPossibleEndlessLoops();
+
 	Dialogue->PostEditChange();
 
 	FDlgEditorUtilities::RefreshDialogueEditorForGraph(DialogueGraph);
@@ -373,6 +458,66 @@ void FDlgCompilerContext::FixBrokenOldIndicesAndUpdateGUID()
 	FDlgEditorUtilities::RemapOldIndicesWithNewAndUpdateGUID(DialogueGraphNodes, IndicesHistory);
 }
 
+void FDlgCompilerContext::ReportPossibleEndlessLoops()
+{
+	const TArray<UDlgNode*>& Nodes = Dialogue->GetNodes();
+	auto IsVirtualParent = [&Nodes](int32 NodeIndex)
+	{
+		const UDlgNode_Speech* Speech = Nodes.IsValidIndex(NodeIndex) ? Cast<UDlgNode_Speech>(Nodes[NodeIndex]) : nullptr;
+		return Speech && Speech->IsVirtualParent();
+	};
+
+	// The edges followed in a single step:
+	// Selectors and proxies enter their targets, virtual parents reevaluate their virtual parent children
+	TArray<TArray<int32>> StepGraph;
+	StepGraph.SetNum(Nodes.Num());
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); NodeIndex++)
+	{
+		const UDlgNode* Node = Nodes[NodeIndex];
+		if (const UDlgNode_Proxy* Proxy = Cast<UDlgNode_Proxy>(Node))
+		{
+			if (Nodes.IsValidIndex(Proxy->GetTargetNodeIndex()))
+			{
+				StepGraph[NodeIndex].Add(Proxy->GetTargetNodeIndex());
+			}
+		}
+		else if (Node && (Node->IsA<UDlgNode_Selector>() || IsVirtualParent(NodeIndex)))
+		{
+			const bool bIsVirtualParent = IsVirtualParent(NodeIndex);
+			for (const FDlgEdge& Edge : Node->GetNodeChildren())
+			{
+				if (Nodes.IsValidIndex(Edge.TargetIndex) && (!bIsVirtualParent || IsVirtualParent(Edge.TargetIndex)))
+				{
+					StepGraph[NodeIndex].Add(Edge.TargetIndex);
+				}
+			}
+		}
+	}
+
+	for (TArray<int32>& Component : GetStronglyConnectedComponents(StepGraph))
+	{
+		// A single node is only a loop if it points to itself
+		if (Component.Num() == 1 && !StepGraph[Component[0]].Contains(Component[0]))
+		{
+			continue;
+		}
+
+		Component.Sort();
+		TArray<FString> NodesStrings;
+		for (const int32 NodeIndex : Component)
+		{
+			NodesStrings.Add(FString::Printf(TEXT("%s (NodeIndex = %d)"), *Nodes[NodeIndex]->GetNodeTypeString(), NodeIndex));
+		}
+
+		const FString Message = FString::Printf(
+			TEXT("Dialogue = `%s` has a possible endless loop, these nodes can enter each other in a single step: %s"),
+			*Dialogue->GetPathName(), *FString::Join(NodesStrings, TEXT(", "))
+		);
+		MessageLog.Warning(*Message);
+		UE_LOG(LogDlgSystemEditor, Warning, TEXT("%s"), *Message);
+	}
+}
+
 void FDlgCompilerContext::SetNextAvailableIndexToNode(UDialogueGraphNode* GraphNode)
 {
 	// History is important.
@@ -58,6 +58,13 @@ private:
 	/** Sets NextAvailableIndex on the provided nodes, also keeps track of history in IndicesHistory. */
 	void SetNextAvailableIndexToNode(UDialogueGraphNode* GraphNode);
 
+	/**
+	 * Reports the strongly connected components of the selector, proxy and virtual parent chains.
+	 * These nodes can follow each other in a single step without the player choosing anything, so any cycle between them
+	 * is a possible endless loop that the runtime can only detect after re-entering.
+	 */
+	void ReportPossibleEndlessLoops();
+
 private:
 	/** The dialogue being compiled. */
 	UDlgDialogue* Dialogue = nullptr;
@@ -405,7 +405,8 @@ void FDlgEditor::InitDialogueEditor(
 
 void FDlgEditor::CheckAll() const
 {
-#if DO_CHECK
+	// Walks the whole graph, too slow for the big Dialogues outside of the debug builds
+#if DO_GUARD_SLOW
 	check(DialogueBeingEdited);
 	UDialogueGraph* Graph = GetDialogueGraph();
 	for (UEdGraphNode* GraphNode : Graph->Nodes)
@@ -961,8 +962,8 @@ void FDlgEditor::OnCommandDeleteSelectedNodes() const
 	// Unselect nodes we are about to delete
 	ClearViewportSelection();
 
-	// Disable compiling for optimization
-	DialogueBeingEdited->DisableCompileDialogue();
+	// Compile only once at the end, for optimization
+	DialogueBeingEdited->BeginDeferCompileDialogue();
 
 	// Helper function to also count the number of removed nodes
 	auto RemoveGraphNode = [&NumNodesRemoved](UEdGraphNode* NodeToRemove)
@@ -1054,10 +1055,15 @@ void FDlgEditor::OnCommandDeleteSelectedNodes() const
 		}
 	}
 
-	DialogueBeingEdited->EnableCompileDialogue();
+	// Compiles once, also if only the links of the removed nodes requested it
 	if (NumBaseDialogueNodesRemoved > 0)
 	{
 		DialogueBeingEdited->CompileDialogueNodesFromGraphNodes();
+	}
+	DialogueBeingEdited->EndDeferCompileDialogue();
+
+	if (NumBaseDialogueNodesRemoved > 0)
+	{
 		DialogueBeingEdited->PostEditChange();
 		DialogueBeingEdited->MarkPackageDirty();
 		RefreshViewport();
@@ -1150,8 +1156,8 @@ void FDlgEditor::PasteNodesHere(const FNYVector2f& Location)
 	// Clear the selection set (newly pasted stuff will be selected)
 	ClearViewportSelection();
 
-	// Disable compiling for optimization
-	DialogueBeingEdited->DisableCompileDialogue();
+	// Compile only once at the end, for optimization
+	DialogueBeingEdited->BeginDeferCompileDialogue();
 
 	// Grab the text to paste from the clipboard.
 	FString TextToImport;
@@ -1277,8 +1283,8 @@ void FDlgEditor::PasteNodesHere(const FNYVector2f& Location)
 
 	// Compile
 	CheckAll();
-	DialogueBeingEdited->EnableCompileDialogue();
 	DialogueBeingEdited->CompileDialogueNodesFromGraphNodes();
+	DialogueBeingEdited->EndDeferCompileDialogue();
 
 	// Notify objects of change
 	RefreshViewport();
@@ -5,6 +5,7 @@
 
 #include "DlgSystem/DlgDialogue.h"
 #include "DialogueGraphSchema.h"
+#include "DlgGraphConnectionDrawingPolicy.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Root.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Edge.h"
@@ -234,3 +235,12 @@ const UDialogueGraphSchema* UDialogueGraph::GetDialogueGraphSchema() const
 {
 	return GetDefault<UDialogueGraphSchema>(Schema);
 }
+
+FDlgGraphNodeWidgetMapCache& UDialogueGraph::GetNodeWidgetMapCache()
+{
+	if (!NodeWidgetMapCache.IsValid())
+	{
+		NodeWidgetMapCache = MakeShared<FDlgGraphNodeWidgetMapCache>();
+	}
+	return *NodeWidgetMapCache;
+}
@@ -14,6 +14,7 @@ class UDialogueGraphNode;
 class UDialogueGraphNode_Root;
 class UDialogueGraphNode_Edge;
 class UDialogueGraphSchema;
+struct FDlgGraphNodeWidgetMapCache;
 
 UCLASS()
 class UDialogueGraph : public UEdGraph
@@ -75,6 +76,9 @@ public:
 	/** Helper method to get directly the Dialogue Graph Schema */
 	const UDialogueGraphSchema* GetDialogueGraphSchema() const;
 
+	/** The node widgets map of the FDlgGraphConnectionDrawingPolicy, kept between the paints */
+	FDlgGraphNodeWidgetMapCache& GetNodeWidgetMapCache();
+
 private:
 	UDialogueGraph(const FObjectInitializer& ObjectInitializer);
 
@@ -84,4 +88,8 @@ private:
 		const UDlgNode& NodeDialogue,
 		UDialogueGraphNode* NodeGraph
 	) const;
+
+private:
+	// Transient, only used for drawing, created on the first paint
+	TSharedPtr<FDlgGraphNodeWidgetMapCache> NodeWidgetMapCache;
 };
@@ -238,6 +238,9 @@ bool UDialogueGraphSchema::TryCreateConnection(UEdGraphPin* PinA, UEdGraphPin* P
 		FDlgEditorUtilities::GetDialogueForGraph(Graph)->Modify();
 	}
 
+	// Breaking the former links also requests compilations, compile only once
+	const FDlgDeferCompileDialogueScope DeferCompile(FDlgEditorUtilities::GetDialogueForGraph(Graph));
+
 	const bool bModified = Super::TryCreateConnection(PinA, PinB);
 	if (bModified)
 	{
@@ -315,6 +318,8 @@ void UDialogueGraphSchema::BreakNodeLinks(UEdGraphNode& TargetNode) const
 	verify(TargetNode.Modify());
 	verify(Dialogue->Modify());
 
+	// Every broken pin requests a compilation, compile only once
+	const FDlgDeferCompileDialogueScope DeferCompile(Dialogue);
 	Super::BreakNodeLinks(TargetNode);
 
 #if DO_CHECK
@@ -340,6 +345,8 @@ void UDialogueGraphSchema::BreakPinLinks(UEdGraphPin& TargetPin, bool bSendsNode
 	verify(Dialogue->Modify());
 	// Modify() is called in BreakLinkTo on the TargetPin
 
+	// Every broken link requests a compilation, compile only once
+	const FDlgDeferCompileDialogueScope DeferCompile(Dialogue);
 	Super::BreakPinLinks(TargetPin, bSendsNodeNotifcation);
 
 #if DO_CHECK
@@ -6,6 +6,36 @@
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Edge.h"
 #include "DlgSystemEditor/Editor/Nodes/SDlgGraphNode_Edge.h"
+#include "DialogueGraph.h"
+
+/////////////////////////////////////////////////////
+// FDlgGraphNodeWidgetMapCache
+const TMap<UEdGraphNode*, int32>& FDlgGraphNodeWidgetMapCache::Update(const FArrangedChildren& ArrangedNodes)
+{
+	// Comparing the pointers is a lot cheaper than hashing all the nodes again
+	bool bSameNodes = ArrangedGraphNodes.Num() == ArrangedNodes.Num();
+	for (int32 NodeIndex = 0; bSameNodes && NodeIndex < ArrangedNodes.Num(); ++NodeIndex)
+	{
+		const TSharedRef<SGraphNode> ChildNode = StaticCastSharedRef<SGraphNode>(ArrangedNodes[NodeIndex].Widget);
+		bSameNodes = ArrangedGraphNodes[NodeIndex] == ChildNode->GetNodeObj();
+	}
+	if (bSameNodes)
+	{
+		return NodeWidgetMap;
+	}
+
+	// Build an acceleration structure to quickly find geometry for the nodes
+	ArrangedGraphNodes.Reset(ArrangedNodes.Num());
+	NodeWidgetMap.Reset();
+	for (int32 NodeIndex = 0; NodeIndex < ArrangedNodes.Num(); ++NodeIndex)
+	{
+		const TSharedRef<SGraphNode> ChildNode = StaticCastSharedRef<SGraphNode>(ArrangedNodes[NodeIndex].Widget);
+		ArrangedGraphNodes.Add(ChildNode->GetNodeObj());
+		NodeWidgetMap.Add(ChildNode->GetNodeObj(), NodeIndex);
+	}
+
+	return NodeWidgetMap;
+}
 
 /////////////////////////////////////////////////////
 // FDlgGraphConnectionDrawingPolicy
@@ -65,8 +95,8 @@ void FDlgGraphConnectionDrawingPolicy::DetermineLinkGeometry(
 		// From Parent to Child, the Edge is just a proxy
 		UDialogueGraphNode* ParentNode = GraphNode_Edge->GetParentNode();
 		UDialogueGraphNode* ChildNode = GraphNode_Edge->GetChildNode();
-		int32* PrevNodeIndex = NodeWidgetMap.Find(ParentNode);
-		int32* NextNodeIndex = NodeWidgetMap.Find(ChildNode);
+		const int32* PrevNodeIndex = NodeWidgetMap->Find(ParentNode);
+		const int32* NextNodeIndex = NodeWidgetMap->Find(ChildNode);
 		if (PrevNodeIndex != nullptr && NextNodeIndex != nullptr)
 		{
 			StartWidgetGeometry = &(ArrangedNodes[*PrevNodeIndex]);
@@ -102,6 +132,12 @@ void FDlgGraphConnectionDrawingPolicy::DrawSplineWithArrow(
 void FDlgGraphConnectionDrawingPolicy::DrawSplineWithArrow(const FNYVector2f& StartPoint, const FNYVector2f& EndPoint,
 	const FConnectionParams& Params)
 {
+	// Off-screen, skip the spline, arrow and hover test
+	if (!IsLineVisible(StartPoint, EndPoint, Params))
+	{
+		return;
+	}
+
 	Internal_DrawLineWithArrow(StartPoint, EndPoint, Params);
 	// Is the connection bidirectional?
 	if (Params.bUserFlag1)
@@ -342,13 +378,14 @@ FNYVector2f FDlgGraphConnectionDrawingPolicy::ComputeSplineTangent(const FNYVect
 void FDlgGraphConnectionDrawingPolicy::Draw(TMap<TSharedRef<SWidget>, FArrangedWidget>& InPinGeometries,
 	FArrangedChildren& ArrangedNodes)
 {
-	// Build an acceleration structure to quickly find geometry for the nodes
-	NodeWidgetMap.Empty();
-	for (int32 NodeIndex = 0; NodeIndex < ArrangedNodes.Num(); ++NodeIndex)
+	// Acceleration structure to quickly find geometry for the nodes, reused between paints
+	if (UDialogueGraph* DialogueGraph = Cast<UDialogueGraph>(Graph))
 	{
-		FArrangedWidget& CurWidget = ArrangedNodes[NodeIndex];
-		TSharedRef<SGraphNode> ChildNode = StaticCastSharedRef<SGraphNode>(CurWidget.Widget);
-		NodeWidgetMap.Add(ChildNode->GetNodeObj(), NodeIndex);
+		NodeWidgetMap = &DialogueGraph->GetNodeWidgetMapCache().Update(ArrangedNodes);
+	}
+	else
+	{
+		NodeWidgetMap = &LocalNodeWidgetMapCache.Update(ArrangedNodes);
 	}
 
 	// Now draw
@@ -394,3 +431,21 @@ void FDlgGraphConnectionDrawingPolicy::Internal_DrawLineWithArrow(
 		);
 	}
 }
+
+bool FDlgGraphConnectionDrawingPolicy::IsLineVisible(
+	const FNYVector2f& StartPoint,
+	const FNYVector2f& EndPoint,
+	const FConnectionParams& Params
+) const
+{
+	// The lines are straight, the bounds of the end points are enough, grown by the arrow and the offset of the bidirectional lines
+	const float Padding = FMath::Max(ArrowRadius.X, ArrowRadius.Y) + Params.WireThickness + 4.5f;
+	const FSlateRect LineRect(
+		FMath::Min(StartPoint.X, EndPoint.X) - Padding,
+		FMath::Min(StartPoint.Y, EndPoint.Y) - Padding,
+		FMath::Max(StartPoint.X, EndPoint.X) + Padding,
+		FMath::Max(StartPoint.Y, EndPoint.Y) + Padding
+	);
+
+	return FSlateRect::DoRectanglesIntersect(LineRect, ClippingRect);
+}
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "Layout/ArrangedWidget.h"
+#include "Layout/ArrangedChildren.h"
 #include "Widgets/SWidget.h"
 #include "ConnectionDrawingPolicy.h"
 
@@ -9,6 +10,21 @@
 
 class FSlateWindowElementList;
 class UEdGraph;
+class UEdGraphNode;
+
+// Maps the graph nodes to their index in the arranged nodes of the graph panel
+// Kept by the UDialogueGraph between paints, only rebuilt if the arranged nodes change (graph edits or nodes culled by the panel)
+struct FDlgGraphNodeWidgetMapCache
+{
+public:
+	// Rebuilds the map if the ArrangedNodes differ from the last ones
+	const TMap<UEdGraphNode*, int32>& Update(const FArrangedChildren& ArrangedNodes);
+
+protected:
+	// The nodes of the ArrangedNodes of the last update, in order
+	TArray<UEdGraphNode*> ArrangedGraphNodes;
+	TMap<UEdGraphNode*, int32> NodeWidgetMap;
+};
 
 // This class draws the connections for an UEdGraph using a Dialogue schema
 // Aka how the wires look and and the flow look.
@@ -78,11 +94,17 @@ public:
 protected:
 	void Internal_DrawLineWithArrow(const FNYVector2f& StartAnchorPoint, const FNYVector2f& EndAnchorPoint, const FConnectionParams& Params);
 
+	// Is any part of the line (with its arrow) inside the ClippingRect?
+	bool IsLineVisible(const FNYVector2f& StartPoint, const FNYVector2f& EndPoint, const FConnectionParams& Params) const;
+
 	// Map for widgets
 	UEdGraph* Graph = nullptr;
 
-	// Map for widgets
-	TMap<UEdGraphNode*, int32> NodeWidgetMap;
+	// Map for widgets, owned by the cache of the graph or by LocalNodeWidgetMapCache
+	const TMap<UEdGraphNode*, int32>* NodeWidgetMap = nullptr;
+
+	// Used if the Graph is not a UDialogueGraph
+	FDlgGraphNodeWidgetMapCache LocalNodeWidgetMapCache;
 
 	// Cache the settings
 	const UDlgSystemSettings* DialogueSettings = nullptr;
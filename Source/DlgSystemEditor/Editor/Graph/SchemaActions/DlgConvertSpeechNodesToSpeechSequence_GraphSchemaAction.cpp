@@ -5,6 +5,7 @@
 
 #include "DlgNewNode_GraphSchemaAction.h"
 #include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/DlgHelper.h"
 #include "DlgSystemEditor/DlgEditorUtilities.h"
 #include "DlgSystem/Nodes/DlgNode_SpeechSequence.h"
 #include "DlgSystem/Nodes/DlgNode_Speech.h"
@@ -22,8 +23,8 @@ UEdGraphNode* FDlgConvertSpeechNodesToSpeechSequence_GraphSchemaAction::PerformA
 	const FScopedTransaction Transaction(LOCTEXT("DialogueditorConvertSpeechNodesToSpeechSequence", "Convert Speech Nodes to a Sequence Node"));
 	UDlgDialogue* Dialogue = FDlgEditorUtilities::GetDialogueForGraph(ParentGraph);
 
-	// Disable compiling for optimization
-	Dialogue->DisableCompileDialogue();
+	// Compile only once at the end, for optimization
+	Dialogue->BeginDeferCompileDialogue();
 
 	// Step 1. Create the final speech sequence
 	UDialogueGraphNode* GraphNode_SpeechSequence = FDlgNewNode_GraphSchemaAction::SpawnGraphNodeWithDialogueNodeFromTemplate<UDialogueGraphNode>(
@@ -41,9 +42,15 @@ UEdGraphNode* FDlgConvertSpeechNodesToSpeechSequence_GraphSchemaAction::PerformA
 		SequenceEntry.Text = DialogueNode_Speech.GetNodeText();
 		SequenceEntry.NodeData = DialogueNode_Speech.GetNodeData();
 		SequenceEntry.SpeakerState = DialogueNode_Speech.GetSpeakerState();
-		SequenceEntry.VoiceSoundWave = DialogueNode_Speech.GetNodeVoiceSoundBase();
-		SequenceEntry.VoiceDialogueWave = DialogueNode_Speech.GetNodeVoiceDialogueWave();
-		SequenceEntry.GenericData = DialogueNode_Speech.GetNodeGenericData();
+		SequenceEntry.SoftVoiceSoundWave = DialogueNode_Speech.GetNodeSoftVoiceSoundBase();
+		SequenceEntry.SoftVoiceDialogueWave = DialogueNode_Speech.GetNodeSoftVoiceDialogueWave();
+		SequenceEntry.SoftGenericData = DialogueNode_Speech.GetNodeSoftGenericData();
+
+		// The soft getters also return the hard references, keep the reference type of the settings
+		const bool bUseSoftReferences = GetDefault<UDlgSystemSettings>()->bUseSoftReferencesForNodeAssets;
+		FDlgHelper::ConvertAssetReference(SequenceEntry.VoiceSoundWave, SequenceEntry.SoftVoiceSoundWave, bUseSoftReferences);
+		FDlgHelper::ConvertAssetReference(SequenceEntry.VoiceDialogueWave, SequenceEntry.SoftVoiceDialogueWave, bUseSoftReferences);
+		FDlgHelper::ConvertAssetReference(SequenceEntry.GenericData, SequenceEntry.SoftGenericData, bUseSoftReferences);
 
 		// Set edge if any
 		const TArray<FDlgEdge>& Children = DialogueNode_Speech.GetNodeChildren();
@@ -111,8 +118,8 @@ UEdGraphNode* FDlgConvertSpeechNodesToSpeechSequence_GraphSchemaAction::PerformA
 		ChildNode->CheckAll();
 	}
 #endif
-	Dialogue->EnableCompileDialogue();
 	Dialogue->CompileDialogueNodesFromGraphNodes();
+	Dialogue->EndDeferCompileDialogue();
 	Dialogue->PostEditChange();
 	Dialogue->MarkPackageDirty();
 	ParentGraph->NotifyGraphChanged();
@@ -30,8 +30,8 @@ UEdGraphNode* FDlgConvertSpeechSequenceNodeToSpeechNodes_GraphSchemaAction::Perf
 	const TArray<FDlgSpeechSequenceEntry>& SpeechSequenceEntries = SpeechSequence_DialogueNode.GetNodeSpeechSequence();
 	check(SpeechSequenceEntries.Num() > 0);
 
-	// Disable compiling for optimization
-	Dialogue->DisableCompileDialogue();
+	// Compile only once at the end, for optimization
+	Dialogue->BeginDeferCompileDialogue();
 
 	// Step 1. Create and position the final speech nodes array
 	TArray<UDialogueGraphNode*> SpeechNodes;
@@ -64,6 +64,9 @@ UEdGraphNode* FDlgConvertSpeechSequenceNodeToSpeechNodes_GraphSchemaAction::Perf
 		Speech_DialogueNode->SetVoiceSoundBase(SequenceEntry.VoiceSoundWave);
 		Speech_DialogueNode->SetVoiceDialogueWave(SequenceEntry.VoiceDialogueWave);
 		Speech_DialogueNode->SetGenericData(SequenceEntry.GenericData);
+		Speech_DialogueNode->SetSoftVoiceSoundBase(SequenceEntry.SoftVoiceSoundWave);
+		Speech_DialogueNode->SetSoftVoiceDialogueWave(SequenceEntry.SoftVoiceDialogueWave);
+		Speech_DialogueNode->SetSoftGenericData(SequenceEntry.SoftGenericData);
 
 		// Create edge to next node
 		if (NodeIndex + 1 < NodesNum)
@@ -104,8 +107,8 @@ UEdGraphNode* FDlgConvertSpeechSequenceNodeToSpeechNodes_GraphSchemaAction::Perf
 	}
 #endif
 
-	Dialogue->EnableCompileDialogue();
 	Dialogue->CompileDialogueNodesFromGraphNodes();
+	Dialogue->EndDeferCompileDialogue();
 	Dialogue->PostEditChange();
 	Dialogue->MarkPackageDirty();
 	ParentGraph->NotifyGraphChanged();
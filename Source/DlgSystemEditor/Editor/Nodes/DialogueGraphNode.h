@@ -224,12 +224,13 @@ public:
 		return false;
 	}
 
-	/** Is this a selector Random Node? */
+	/** Is this a selector Random Node? Weighted or not */
 	bool IsSelectorRandomNode() const
 	{
 		if (const UDlgNode_Selector* Node = Cast<UDlgNode_Selector>(DialogueNode))
 		{
-			return Node->GetSelectorType() == EDlgNodeSelectorType::Random;
+			return Node->GetSelectorType() == EDlgNodeSelectorType::Random
+				|| Node->GetSelectorType() == EDlgNodeSelectorType::WeightedRandom;
 		}
 
 		return false;
@@ -283,6 +284,10 @@ public:
 		NodeIndex = InIndex;
 	}
 
+	/** The desired size of the node body the last time it was drawn in high detail, the zoomed out placeholder keeps it */
+	const FVector2D& GetLastNodeBodySize() const { return LastNodeBodySize; }
+	void SetLastNodeBodySize(const FVector2D& InSize) { LastNodeBodySize = InSize; }
+
 	// Where should the edges pointing to this node be positioned at
 	// NOTE: we use this because otherwise the edges don't get rendered
 	FIntPoint GetDefaultEdgePosition() const { return GetPosition() + FIntPoint(5, 5); }
@@ -434,6 +439,10 @@ protected:
 	UPROPERTY()
 	int32 NodeDepth = INDEX_NONE;
 
+	/** The desired size of the node body the last time it was drawn in high detail. Saved, so the graphs opened zoomed out keep their layout */
+	UPROPERTY()
+	FVector2D LastNodeBodySize = FVector2D::ZeroVector;
+
 	/** Used to highlight the node if the currently selected node is a proxy targeting it */
 	UPROPERTY(Transient)
 	bool bUseBorderHighlight = false;
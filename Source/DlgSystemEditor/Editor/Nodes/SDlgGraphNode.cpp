@@ -68,6 +68,21 @@ FReply SDlgGraphNode::OnMouseButtonDoubleClick(const FGeometry& InMyGeometry, co
 	return Super::OnMouseButtonDoubleClick(InMyGeometry, InMouseEvent);
 }
 
+void SDlgGraphNode::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	Super::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// The content is only prepassed while it is in the tree, remember its last size for the zoomed out placeholder
+	if (DialogueGraphNode && NodeBodyContentWidget.IsValid() && !UseLowDetailNodeBody())
+	{
+		const FVector2D DesiredSize = FVector2D(NodeBodyContentWidget->GetDesiredSize());
+		if (!DesiredSize.IsNearlyZero())
+		{
+			DialogueGraphNode->SetLastNodeBodySize(DesiredSize);
+		}
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Begin SNodePanel::SNode Interface
 TArray<FOverlayWidgetInfo> SDlgGraphNode::GetOverlayWidgets(bool bSelected, const FNYVector2f& WidgetSize) const
@@ -79,6 +94,13 @@ TArray<FOverlayWidgetInfo> SDlgGraphNode::GetOverlayWidgets(bool bSelected, cons
 	check(GenericOverlayWidget.IsValid());
 
 	TArray<FOverlayWidgetInfo> Widgets;
+
+	// LOD this out once things get too small, the widgets would be collapsed anyway
+	if (GetOverlayWidgetVisibility() != EVisibility::Visible)
+	{
+		return Widgets;
+	}
+
 	static constexpr float DistanceBetweenWidgetsY = 1.5f;
 	FNYVector2f OriginRightSide(0.0f, 0.0f);
 	FNYVector2f OriginLeftSide(0.0f, 0.0f);
@@ -330,6 +352,11 @@ TSharedRef<SWidget> SDlgGraphNode::GetNodeBodyWidget()
 //	PopulateMetaTag(&TagMeta);
 
 	TSharedPtr<SVerticalBox> NodeVerticalBox;
+	SAssignNew(NodeVerticalBox, SVerticalBox);
+
+	// When zoomed out the content is replaced with an empty box of the same size, the graph keeps its layout
+	// while the texts and icons are not laid out and painted for every node
+	NodeBodyContentWidget = NodeVerticalBox;
 
 	NodeBodyWidget =
 		SNew(SBorder)
@@ -340,8 +367,19 @@ TSharedRef<SWidget> SDlgGraphNode::GetNodeBodyWidget()
 		.Padding(1.0f)
 		.Visibility(EVisibility::Visible)
 		[
-			// Main Content
-			SAssignNew(NodeVerticalBox, SVerticalBox)
+			SNew(SLevelOfDetailBranchNode)
+			.UseLowDetailSlot(this, &Self::UseLowDetailNodeBody)
+			.LowDetail()
+			[
+				SNew(SBox)
+				.WidthOverride(this, &Self::GetNodeBodyPlaceholderWidth)
+				.HeightOverride(this, &Self::GetNodeBodyPlaceholderHeight)
+			]
+			.HighDetail()
+			[
+				// Main Content
+				NodeVerticalBox.ToSharedRef()
+			]
 		];
 
 	NodeVerticalBox->AddSlot()
@@ -366,6 +404,18 @@ TSharedRef<SWidget> SDlgGraphNode::GetNodeBodyWidget()
 	return NodeBodyWidget.ToSharedRef();
 }
 
+FOptionalSize SDlgGraphNode::GetNodeBodyPlaceholderWidth() const
+{
+	static constexpr float MinWidth = 100.0f;
+	return FMath::Max(MinWidth, DialogueGraphNode ? static_cast<float>(DialogueGraphNode->GetLastNodeBodySize().X) : 0.0f);
+}
+
+FOptionalSize SDlgGraphNode::GetNodeBodyPlaceholderHeight() const
+{
+	static constexpr float MinHeight = 40.0f;
+	return FMath::Max(MinHeight, DialogueGraphNode ? static_cast<float>(DialogueGraphNode->GetLastNodeBodySize().Y) : 0.0f);
+}
+
 TSharedRef<SWidget> SDlgGraphNode::GetTitleWidget()
 {
 	if (TitleWidget.IsValid())
@@ -47,6 +47,7 @@ public:
 	{
 		return Super::OnMouseMove(SenderGeometry, MouseEvent);
 	}
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
 	// End of SWidget interface
 
 	// Begin SNodePanel::SNode Interface
@@ -93,6 +94,17 @@ protected:
 		return false;
 	}
 
+	/** Should we replace the whole node body with a placeholder of the same size? Used by GetNodeBodyWidget() */
+	bool UseLowDetailNodeBody() const
+	{
+		if (const SGraphPanel* MyOwnerPanel = GetOwnerPanel().Get())
+		{
+			return MyOwnerPanel->GetCurrentLOD() <= EGraphRenderingLOD::LowestDetail;
+		}
+
+		return false;
+	}
+
 	/** Return the desired comment bubble color */
 	virtual FSlateColor GetCommentColor() const override { return DialogueGraphNode->GetNodeBackgroundColor(); }
 
@@ -106,6 +118,10 @@ protected:
 	/** Gets/Creates the inner node content area. Used by UpdateGraphNode() */
 	TSharedRef<SWidget> GetNodeBodyWidget();
 
+	/** Size of the placeholder that replaces the node body when zoomed out, see UDialogueGraphNode::GetLastNodeBodySize */
+	FOptionalSize GetNodeBodyPlaceholderWidth() const;
+	FOptionalSize GetNodeBodyPlaceholderHeight() const;
+
 	/** Gets the actual title widget to display */
 	TSharedRef<SWidget> GetTitleWidget();
 
@@ -193,6 +209,9 @@ protected:
 	/** The node body widget, cached here so we can determine its size when we want ot position our overlays */
 	TSharedPtr<SBorder> NodeBodyWidget;
 
+	/** The high detail content of the node body, only laid out when not zoomed out */
+	TSharedPtr<SWidget> NodeBodyContentWidget;
+
 	/** The widget that holds the title section */
 	TSharedPtr<SWidget> TitleWidget;
 